@@ -764,6 +764,109 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode(const struct json_obj_descr *descr, const void *val,
 		    json_append_bytes_t append_bytes, void *data);
 
+struct net_buf;
+
+/**
+ * @brief Function pointer type for tokens found by json_stream_feed()
+ *
+ * Tokens are the ones of the in-memory parser: JSON_TOK_OBJECT_START,
+ * JSON_TOK_OBJECT_END, JSON_TOK_ARRAY_START, JSON_TOK_ARRAY_END,
+ * JSON_TOK_COLON and JSON_TOK_COMMA carry no data, JSON_TOK_STRING (without
+ * the quotes, not unescaped), JSON_TOK_NUMBER, JSON_TOK_TRUE, JSON_TOK_FALSE
+ * and JSON_TOK_NULL point to their text. A string followed by a
+ * JSON_TOK_COLON is an object key.
+ *
+ * @param type Token type
+ * @param start Token text, only valid during the callback
+ * @param len Length of the token text
+ * @param user_data User-provided pointer
+ *
+ * @return 0 to continue parsing, any other value stops the parser and is
+ * returned by json_stream_feed()
+ */
+typedef int (*json_stream_cb_t)(enum json_tokens type, const char *start,
+				size_t len, void *user_data);
+
+/**
+ * @brief Streaming parser state, see json_stream_init()
+ */
+struct json_stream {
+	json_stream_cb_t cb;
+	void *user_data;
+	/* Holds a token split across fragments */
+	char *buf;
+	size_t buf_size;
+	size_t buf_len;
+	/* Bit n is set if nesting level n is an object */
+	uint32_t nesting;
+	uint8_t depth;
+	uint8_t state;
+	/* Token being scanned, JSON_TOK_NONE between tokens */
+	uint8_t token;
+	uint8_t escape;
+	int error;
+};
+
+/**
+ * @brief Initialize a streaming parser
+ *
+ * The streaming parser takes a JSON value in any number of fragments,
+ * without the need to put them in one buffer first, and reports the
+ * tokens it finds through @a cb. Tokens are passed straight from the
+ * fragment they are in. Only a string, number or literal which is split
+ * between two fragments is copied to @a buf, which limits the length of
+ * such a token. Nesting is limited to 32 levels.
+ *
+ * @param stream Parser state
+ * @param buf Buffer for tokens split between fragments
+ * @param buf_size Size of @a buf
+ * @param cb Function called for each token
+ * @param user_data Pointer passed to @a cb
+ *
+ * @return 0 on success, -EINVAL on invalid arguments.
+ */
+int json_stream_init(struct json_stream *stream, char *buf, size_t buf_size,
+		     json_stream_cb_t cb, void *user_data);
+
+/**
+ * @brief Feed the next fragment to a streaming parser
+ *
+ * @param stream Parser state
+ * @param data Next fragment of JSON text
+ * @param len Length of the fragment
+ *
+ * @return 0 on success, -EINVAL if the text is not valid JSON, -ENOMEM if a
+ * split token does not fit the buffer, or the value returned by the
+ * callback if it stopped the parser. Errors are sticky.
+ */
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Feed a chain of network buffer fragments to a streaming parser
+ *
+ * Requires @kconfig{CONFIG_NET_BUF}.
+ *
+ * @param stream Parser state
+ * @param buf First fragment of the chain
+ *
+ * @return See json_stream_feed().
+ */
+int json_stream_feed_net_buf(struct json_stream *stream,
+			     const struct net_buf *buf);
+
+/**
+ * @brief Tell a streaming parser that the JSON text is complete
+ *
+ * Reports a number or literal left at the very end of the text, and
+ * checks that a complete value has been parsed.
+ *
+ * @param stream Parser state
+ *
+ * @return 0 if a complete value has been parsed, a negative error code
+ * otherwise.
+ */
+int json_stream_finish(struct json_stream *stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,92 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILER_H_
+#define ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/init.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup boot_profiler Boot profiler
+ *  @ingroup os_services
+ *  @brief Timing of init levels and init entries
+ *
+ *  With CONFIG_BOOT_PROFILER, the kernel timestamps each init level and
+ *  each SYS_INIT or device init entry it runs during boot, in the order
+ *  they complete.
+ *  @{
+ */
+
+/** A timed init level or init entry */
+struct boot_profiler_record {
+	/** Init entry, or NULL if the record covers a whole init level */
+	const struct init_entry *entry;
+	/** Start of the init level or entry, in hardware cycles */
+	uint32_t start;
+	/** End of the init level or entry, in hardware cycles */
+	uint32_t end;
+	/** Value returned by the init function, 0 for init levels */
+	int16_t result;
+	/** Init level, 0 being EARLY */
+	uint8_t level;
+};
+
+/** @brief Get the boot profile
+ *
+ *  Records are stored in the order the init levels and entries completed.
+ *  Once CONFIG_BOOT_PROFILER_RECORDS records are stored, further ones are
+ *  dropped and only counted.
+ *
+ *  @param records Set to the first record.
+ *  @param dropped Set to the number of dropped records, may be NULL.
+ *
+ *  @return Number of records.
+ */
+size_t boot_profiler_records_get(const struct boot_profiler_record **records,
+				 size_t *dropped);
+
+/** @brief Get the name of an init level
+ *
+ *  @param level Init level, as found in struct boot_profiler_record.
+ *
+ *  @return Name of the init level.
+ */
+const char *boot_profiler_level_name(uint8_t level);
+
+/** Size of a buffer holding any line formatted by
+ *  boot_profiler_record_format(), longer device names are truncated
+ */
+#define BOOT_PROFILER_LINE_LEN 64
+
+/** @brief Format a boot profile record as a line of text
+ *
+ *  This is the format used by boot_profiler_print() and the
+ *  "kernel boot-profile" shell command.
+ *
+ *  @param record Record to format, or NULL for the column headers.
+ *  @param buf Buffer for the line, without a trailing newline.
+ *  @param len Size of @p buf.
+ *
+ *  @return Length of the untruncated line, as returned by snprintk().
+ */
+int boot_profiler_record_format(const struct boot_profiler_record *record,
+				char *buf, size_t len);
+
+/** @brief Print the boot profile on the console */
+void boot_profiler_print(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILER_H_ */
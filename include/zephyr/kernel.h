@@ -84,6 +84,7 @@ struct k_mem_domain;
 struct k_mem_partition;
 struct k_futex;
 struct k_event;
+struct k_cycle_histogram;
 
 enum execution_context_types {
 	K_ISR = 0,
@@ -2815,6 +2816,19 @@ extern struct k_work_q k_sys_work_q;
  * @{
  */
 
+/**
+ * Contention statistics of a mutex or semaphore
+ * @ingroup mutex_apis
+ */
+struct k_sync_contention_stats {
+	/** Times a blocking caller found the object unavailable */
+	uint32_t contended;
+	/** Times such a caller acquired it by adaptive spinning */
+	uint32_t spin_acquired;
+	/** Times such a caller pended on it */
+	uint32_t pended;
+};
+
 /**
  * Mutex Structure
  * @ingroup mutex_apis
@@ -2831,6 +2845,11 @@ struct k_mutex {
 	/** Original thread priority */
 	int owner_orig_prio;
 
+#ifdef CONFIG_SYNC_CONTENTION_STATS
+	/** Contention statistics */
+	struct k_sync_contention_stats contention;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mutex)
 };
 
@@ -2922,6 +2941,21 @@ __syscall int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
  */
 __syscall int k_mutex_unlock(struct k_mutex *mutex);
 
+/**
+ * @brief Get the contention statistics of a mutex
+ *
+ * This routine copies the contention counters of @a mutex. It is only
+ * available with CONFIG_SYNC_CONTENTION_STATS.
+ *
+ * @param mutex Address of the mutex.
+ * @param stats Pointer to memory into which to copy the statistics
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Any parameter points to NULL
+ */
+int k_mutex_contention_stats_get(struct k_mutex *mutex,
+				 struct k_sync_contention_stats *stats);
+
 /**
  * @}
  */
@@ -3015,6 +3049,10 @@ struct k_sem {
 
 	_POLL_EVENT;
 
+#ifdef CONFIG_SYNC_CONTENTION_STATS
+	struct k_sync_contention_stats contention;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_sem)
 
 };
@@ -3127,6 +3165,21 @@ static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 	return sem->count;
 }
 
+/**
+ * @brief Get the contention statistics of a semaphore
+ *
+ * This routine copies the contention counters of @a sem. It is only
+ * available with CONFIG_SYNC_CONTENTION_STATS.
+ *
+ * @param sem Address of the semaphore.
+ * @param stats Pointer to memory into which to copy the statistics
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Any parameter points to NULL
+ */
+int k_sem_contention_stats_get(struct k_sem *sem,
+			       struct k_sync_contention_stats *stats);
+
 /**
  * @brief Statically define and initialize a semaphore.
  *
@@ -3252,6 +3305,55 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 extern int k_work_submit(struct k_work *work);
 
+/** @brief Count resubmissions of pending work in k_work_submit_batch().
+ *
+ * Submissions of work items that are already queued are counted on the
+ * item, see k_work_coalesced_take().
+ */
+#define K_WORK_BATCH_COALESCE BIT(0)
+
+/** @brief Submit several work items to a queue.
+ *
+ * This behaves as k_work_submit_to_queue() for each item, but takes the
+ * work queue lock once per step of up to 32 items rather than once per
+ * item, and wakes the work queue at most once for the whole batch.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the work queue on which the items should run.
+ *
+ * @param works array of pointers to the work items.
+ *
+ * @param count number of entries in @p works.
+ *
+ * @param flags 0 or K_WORK_BATCH_COALESCE.
+ *
+ * @return the number of items that were queued (including to the queue
+ * that was running them), if non-zero or if no submission failed.
+ * @retval -EINVAL if @p queue is null.
+ * @retval -EBUSY or -ENODEV as for k_work_submit_to_queue() if no item
+ * was queued and at least one submission was rejected.
+ */
+int k_work_submit_batch(struct k_work_q *queue,
+			struct k_work *const *works,
+			size_t count,
+			uint32_t flags);
+
+/** @brief Get and reset the coalesced submission count of a work item.
+ *
+ * Returns how many times @p work was submitted with
+ * K_WORK_BATCH_COALESCE while it was already queued, since the previous
+ * call.  Handlers call this to learn how many events the run stands for.
+ * The count saturates at 65535.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param work pointer to the work item.
+ *
+ * @return the number of coalesced submissions.
+ */
+uint32_t k_work_coalesced_take(struct k_work *work);
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -3714,6 +3816,9 @@ enum {
 	K_WORK_DELAYABLE_BIT = 8,
 	K_WORK_DELAYABLE = BIT(K_WORK_DELAYABLE_BIT),
 
+	/* Count of submissions coalesced by k_work_submit_batch() */
+	K_WORK_COALESCED_SHIFT = 16,
+
 	/* Dynamic work queue flags */
 	K_WORK_QUEUE_STARTED_BIT = 0,
 	K_WORK_QUEUE_STARTED = BIT(K_WORK_QUEUE_STARTED_BIT),
@@ -3842,13 +3947,22 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* On queues with a worker pool the flusher is not queued.  It
+	 * waits instead for the given number of completions of the
+	 * item.
+	 */
+	struct k_work *target;
+	uint32_t remaining;
+#endif
 };
 
 /* Record used to wait for work to complete a cancellation.
  *
- * The work item is inserted into a global queue of pending cancels.
- * When a cancelling work item goes idle any matching waiters are
- * removed from pending_cancels and are woken.
+ * The work item is inserted into the list of pending cancels kept
+ * with the lock of the work item.  When a cancelling work item goes
+ * idle any matching waiters are removed from pending_cancels and are
+ * woken.
  */
 struct z_work_canceller {
 	sys_snode_t node;
@@ -3906,6 +4020,31 @@ struct k_work_queue_config {
 	 * control.
 	 */
 	bool no_yield;
+
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+	/** Number of threads serving the queue in addition to the
+	 * main one.
+	 *
+	 * When non-zero the queue runs up to 1 + @c pool_size items
+	 * at once, on as many CPUs.  A given item still never runs
+	 * concurrently with itself, and flush, cancel and drain keep
+	 * their semantics, but distinct items lose their ordering.
+	 *
+	 * Requires @kconfig{CONFIG_WORKQUEUE_POOL}.
+	 */
+	size_t pool_size;
+
+	/** Thread objects for the additional threads, @c pool_size of
+	 * them.  They stay in use for the lifetime of the queue.
+	 */
+	struct k_thread *pool_threads;
+
+	/** Stacks for the additional threads, @c pool_size of them,
+	 * each at least as large as the stack passed to
+	 * k_work_queue_start().
+	 */
+	k_thread_stack_t *const *pool_stacks;
+#endif
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -3913,9 +4052,8 @@ struct k_work_q {
 	/* The thread that animates the work. */
 	struct k_thread thread;
 
-	/* All the following fields must be accessed only while the
-	 * work module spinlock is held.
-	 */
+	/* Protects all the following fields. */
+	struct k_spinlock lock;
 
 	/* List of k_work items to be worked. */
 	sys_slist_t pending;
@@ -3928,6 +4066,15 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Additional threads animating the work, and how many of all
+	 * threads are running an item.
+	 */
+	struct k_thread *pool_threads;
+	uint16_t pool_size;
+	uint16_t busy;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4765,6 +4912,12 @@ struct k_pipe {
 
 	_POLL_EVENT;
 
+#ifdef CONFIG_PIPES_CLAIM
+	size_t         put_claimed;     /**< # bytes claimed for writing */
+	size_t         get_claimed;     /**< # bytes claimed for reading */
+	size_t         watermark;       /**< # bytes buffered to wake readers */
+#endif
+
 	uint8_t	       flags;		/**< Flags */
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_pipe)
@@ -4922,6 +5075,113 @@ __syscall size_t k_pipe_read_avail(struct k_pipe *pipe);
  */
 __syscall size_t k_pipe_write_avail(struct k_pipe *pipe);
 
+#if defined(CONFIG_PIPES_CLAIM) || defined(__DOXYGEN__)
+/**
+ * @brief Claim space in the pipe buffer for writing in place.
+ *
+ * This routine gives direct access to up to @a size contiguous free bytes
+ * of the pipe buffer, following any space claimed before and not yet
+ * committed.  The data is made readable with k_pipe_put_commit().
+ *
+ * While space is claimed, k_pipe_put() only hands data over to waiting
+ * readers and does not write to the pipe buffer.
+ *
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the address of the claimed space.
+ * @param size Maximum number of bytes to claim.
+ *
+ * @return Number of bytes claimed, which may be less than @a size (and
+ *         zero for unbuffered or full pipes).
+ */
+size_t k_pipe_put_claim(struct k_pipe *pipe, uint8_t **data, size_t size);
+
+/**
+ * @brief Commit data written in place to the pipe buffer.
+ *
+ * This routine makes the first @a size claimed bytes readable and
+ * releases the rest of the claim.  Waiting readers and pollers are woken
+ * if the pipe then holds at least its watermark, see
+ * k_pipe_watermark_set().
+ *
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written in place.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL @a size exceeds the claimed space.
+ */
+int k_pipe_put_commit(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim data in the pipe buffer for reading in place.
+ *
+ * This routine gives direct access to up to @a size contiguous bytes of
+ * data in the pipe buffer, following any data claimed before and not yet
+ * released.  The data is released with k_pipe_get_finish().
+ *
+ * While data is claimed, k_pipe_get() only takes data from waiting
+ * writers and does not read from the pipe buffer.
+ *
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the address of the claimed data.
+ * @param size Maximum number of bytes to claim.
+ *
+ * @return Number of bytes claimed, which may be less than @a size (and
+ *         zero for unbuffered or empty pipes).
+ */
+size_t k_pipe_get_claim(struct k_pipe *pipe, uint8_t **data, size_t size);
+
+/**
+ * @brief Release data read in place from the pipe buffer.
+ *
+ * This routine frees the first @a size claimed bytes and returns the rest
+ * of the claim to the pipe.  Waiting writers are then given the space.
+ *
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes read in place.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL @a size exceeds the claimed data.
+ */
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Set the watermark of a pipe.
+ *
+ * Data written to the pipe buffer only wakes readers waiting in
+ * k_pipe_get() and pollers of @a pipe once the buffer holds at least
+ * @a watermark bytes.  Data handed directly to a waiting reader by
+ * k_pipe_put() is not affected.  Zero, the default, wakes readers on
+ * every write.
+ *
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param watermark Number of buffered bytes that wakes readers.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL @a watermark exceeds the size of the pipe buffer.
+ */
+int k_pipe_watermark_set(struct k_pipe *pipe, size_t watermark);
+#endif /* CONFIG_PIPES_CLAIM */
+
 /**
  * @brief Flush the pipe of write data
  *
@@ -4953,6 +5213,15 @@ __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
  * @cond INTERNAL_HIDDEN
  */
 
+/* Per-CPU magazine of free blocks.  Its lock is only contended when
+ * an allocator flushes every magazine back to the slab.
+ */
+struct k_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t count;
+};
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -4960,10 +5229,16 @@ struct k_mem_slab {
 	size_t block_size;
 	char *buffer;
 	char *free_list;
+	/* blocks off the shared free list, including per-CPU cached ones */
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	struct k_mem_slab_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Allocators that found the slab exhausted */
+	atomic_t waiters;
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 };
@@ -5104,6 +5379,10 @@ extern int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+extern uint32_t z_mem_slab_num_used_get(struct k_mem_slab *slab);
+#endif
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5116,7 +5395,11 @@ extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	return z_mem_slab_num_used_get(slab);
+#else
 	return slab->num_used;
+#endif
 }
 
 /**
@@ -5151,7 +5434,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->num_blocks - slab->num_used;
+	return slab->num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5190,10 +5473,28 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_HEAP_CPU_CACHE
+/* Power-of-two size classes from 16 bytes up to the configured maximum */
+#define Z_HEAP_CPU_CACHE_CLASSES \
+	(LOG2CEIL(CONFIG_HEAP_CPU_CACHE_MAX_SIZE) - 3)
+
+/* Per-CPU lists of free blocks, one per size class */
+struct k_heap_cpu_cache {
+	struct k_spinlock lock;
+	void *free[Z_HEAP_CPU_CACHE_CLASSES];
+	uint8_t count[Z_HEAP_CPU_CACHE_CLASSES];
+};
+#endif
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_HEAP_CPU_CACHE
+	struct k_heap_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Allocators that found the heap exhausted */
+	atomic_t waiters;
+#endif
 };
 
 /**
@@ -5272,7 +5573,13 @@ void k_heap_free(struct k_heap *h, void *mem);
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
+#ifdef CONFIG_SYS_HEAP_TLSF
+#define Z_HEAP_MIN_SIZE ((CONFIG_SYS_HEAP_TLSF_SL_LOG2 == 1 ? 92 :	\
+			  CONFIG_SYS_HEAP_TLSF_SL_LOG2 == 2 ? 124 : 212) + \
+			 (sizeof(void *) > 4 ? 12 : 0))
+#else
 #define Z_HEAP_MIN_SIZE (sizeof(void *) > 4 ? 56 : 44)
+#endif
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -5719,6 +6026,87 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+#if defined(CONFIG_POLL_SET) || defined(__DOXYGEN__)
+
+/**
+ * @brief Poll set
+ *
+ * A set of poll events that stay registered with their objects across
+ * waits on the set.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set The poll set to initialize.
+ */
+extern void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add a poll event to a poll set.
+ *
+ * The event, initialized with k_poll_event_init(), stays registered with
+ * its object until it is removed from the set with k_poll_set_remove().
+ * It must not be passed to k_poll() or added to another set meanwhile.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param set The poll set.
+ * @param event The event to add.
+ */
+extern void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove a poll event from a poll set.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param set The poll set.
+ * @param event The event to remove.
+ *
+ * @retval 0 The event was removed.
+ * @retval -EINVAL The event is not in @a set.
+ */
+extern int k_poll_set_remove(struct k_poll_set *set,
+			     struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * Only the events that were signaled since the previous wait, and those
+ * that were returned by it, are checked.  Events are level triggered: an
+ * event is returned again by the next wait unless its condition is no
+ * longer met by then.  The state field of each returned event is set to
+ * the K_POLL_STATE_xxx value found, which is K_POLL_STATE_CANCELLED for
+ * an event cancelled e.g. with k_queue_cancel_wait().
+ *
+ * Unlike k_poll(), this is not available to user mode threads.
+ *
+ * @param set The poll set.
+ * @param ready Array filled with pointers to the ready events.
+ * @param max_events The number of entries in @a ready.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return The number of ready events, which is at most @a max_events.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+extern int k_poll_set_wait(struct k_poll_set *set,
+			   struct k_poll_event **ready, int max_events,
+			   k_timeout_t timeout);
+
+#endif /* CONFIG_POLL_SET */
+
 /**
  * @internal
  */
@@ -5992,6 +6380,34 @@ extern void k_sys_runtime_stats_enable(void);
  */
 extern void k_sys_runtime_stats_disable(void);
 
+/**
+ * @brief Get the scheduling histograms of a thread
+ *
+ * This routine copies the wakeup latency and run slice length histograms
+ * of the specified thread. It requires
+ * CONFIG_SCHED_THREAD_USAGE_HISTOGRAM.
+ *
+ * @param thread ID of thread
+ * @param hist Pointer to struct to copy the histograms into
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+__syscall int k_thread_runtime_histogram_get(k_tid_t thread,
+					     struct k_cycle_histogram *hist);
+
+/**
+ * @brief Get the scheduling histograms of a CPU
+ *
+ * This routine copies the wakeup latency and run slice length histograms
+ * of all non-idle threads that ran on the specified CPU. It requires
+ * CONFIG_SCHED_THREAD_USAGE_HISTOGRAM and CONFIG_SCHED_THREAD_USAGE_ALL.
+ *
+ * @param cpu_id Index of the CPU
+ * @param hist Pointer to struct to copy the histograms into
+ * @return -EINVAL if invalid CPU or null pointer, otherwise 0
+ */
+__syscall int k_cpu_runtime_histogram_get(int cpu_id,
+					  struct k_cycle_histogram *hist);
+
 #ifdef __cplusplus
 }
 #endif
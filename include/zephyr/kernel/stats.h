@@ -10,6 +10,20 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+/*
+ * [k_cycle_histogram] counts scheduling events in log2 sized buckets:
+ * bucket [n] counts events of 2^n to 2^(n+1) - 1 cycles (bucket 0 also
+ * counts zero), and the last bucket counts everything longer.
+ */
+struct k_cycle_histogram {
+	/* time from being made ready to being switched in */
+	uint32_t  latency[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS];
+	/* time from being switched in to being switched out */
+	uint32_t  slice[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS];
+};
+#endif
+
 /*
  * [k_cycle_stats] is used to track internal statistics about both thread
  * and CPU usage.
@@ -21,6 +35,11 @@ struct k_cycle_stats {
 	uint64_t  current;      /* # of cycles in current usage window */
 	uint64_t  longest;      /* # of cycles in longest usage window */
 	uint32_t  num_windows;  /* # of usage windows */
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	/* threads: when last made ready, CPUs: when the slice began */
+	uint32_t  stamp;
+	struct k_cycle_histogram histogram;
 #endif
 	bool      track_usage;  /* true if gathering usage stats */
 };
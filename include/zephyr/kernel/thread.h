@@ -179,6 +179,26 @@ struct _mem_domain_info {
 	struct k_mem_domain *mem_domain;
 };
 
+#ifdef CONFIG_SYSCALL_VALIDATION_CACHE
+struct _syscall_cache {
+	/** invalidation generation the entries were validated under */
+	atomic_val_t generation;
+	/** kernel objects the thread was allowed to use */
+	struct {
+		const void *obj;
+		struct z_object *ko;
+	} objs[CONFIG_SYSCALL_VALIDATION_CACHE_SIZE];
+	/** memory buffers the thread was allowed to access */
+	struct {
+		uintptr_t start;
+		uintptr_t end;
+		bool write;
+	} bufs[CONFIG_SYSCALL_VALIDATION_CACHE_SIZE];
+	/** next entries to replace */
+	uint8_t next_obj;
+	uint8_t next_buf;
+};
+#endif /* CONFIG_SYSCALL_VALIDATION_CACHE */
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_THREAD_USERSPACE_LOCAL_DATA
@@ -223,6 +243,14 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	/*
+	 * Wakeup latency and run slice length histograms. For CPUs they
+	 * cover the non-idle threads that ran on the CPU.
+	 */
+	struct k_cycle_histogram histogram;
+#endif
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -264,9 +292,6 @@ struct k_thread {
 
 	uint32_t   events;
 	uint32_t   event_options;
-
-	/** true if timeout should not wake the thread */
-	bool no_wake_on_timeout;
 #endif
 
 #if defined(CONFIG_THREAD_MONITOR)
@@ -310,6 +335,10 @@ struct k_thread {
 	k_thread_stack_t *stack_obj;
 	/** current syscall frame pointer */
 	void *syscall_frame;
+#ifdef CONFIG_SYSCALL_VALIDATION_CACHE
+	/** recently validated syscall arguments */
+	struct _syscall_cache syscall_cache;
+#endif
 #endif /* CONFIG_USERSPACE */
 
 
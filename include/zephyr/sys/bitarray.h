@@ -17,6 +17,23 @@ extern "C" {
 #include <zephyr/kernel.h>
 #include <zephyr/sys/util.h>
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+/* Number of bundles covered by one summary entry */
+#define _SYS_BITARRAY_SUMMARY_GROUP CONFIG_SYS_BITARRAY_SUMMARY_GROUP_BUNDLES
+
+/* Free bits of one group of bundles */
+struct sys_bitarray_summary {
+	/* Free bits at the start of the group */
+	uint16_t head;
+
+	/* Free bits at the end of the group */
+	uint16_t tail;
+
+	/* Longest run of free bits inside the group */
+	uint16_t longest;
+};
+#endif
+
 struct sys_bitarray {
 	/* Number of bits */
 	uint32_t num_bits;
@@ -27,12 +44,38 @@ struct sys_bitarray {
 	/* Bundle of bits */
 	uint32_t *bundles;
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	/* Free space summary, one entry per group of bundles. Only set up
+	 * by SYS_BITARRAY_DEFINE(), bit arrays without one are scanned
+	 * linearly. Once the summary is built, bundles must only be
+	 * changed through the sys_bitarray_*() functions.
+	 */
+	struct sys_bitarray_summary *summary;
+
+	/* True once the summary matches the bundles */
+	bool summary_valid;
+#endif
+
 	/* Spinlock guarding access to this bit array */
 	struct k_spinlock lock;
 };
 
 typedef struct sys_bitarray sys_bitarray_t;
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+#define _SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)		\
+	sba_mod struct sys_bitarray_summary					\
+		_sys_bitarray_summary_##name					\
+		[DIV_ROUND_UP(DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8),	\
+					   sizeof(uint32_t)),			\
+			      _SYS_BITARRAY_SUMMARY_GROUP)];
+#define _SYS_BITARRAY_SUMMARY_INIT(name)				\
+	.summary = _sys_bitarray_summary_##name,
+#else
+#define _SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)
+#define _SYS_BITARRAY_SUMMARY_INIT(name)
+#endif
+
 /**
  * @brief Create a bitarray object.
  *
@@ -44,11 +87,13 @@ typedef struct sys_bitarray sys_bitarray_t;
 	sba_mod uint32_t _sys_bitarray_bundles_##name			\
 		[DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8),		\
 			       sizeof(uint32_t))] = {0};		\
+	_SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)		\
 	sba_mod sys_bitarray_t name = {					\
 		.num_bits = total_bits,					\
 		.num_bundles = DIV_ROUND_UP(				\
 			DIV_ROUND_UP(total_bits, 8), sizeof(uint32_t)),	\
 		.bundles = _sys_bitarray_bundles_##name,		\
+		_SYS_BITARRAY_SUMMARY_INIT(name)			\
 	}
 
 /**
@@ -140,6 +185,13 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
  * marked as allocated and the offset to the start of this region is
  * returned via @p offset.
  *
+ * With @kconfig{CONFIG_SYS_BITARRAY_SUMMARY}, the first allocation from a
+ * bit array defined with SYS_BITARRAY_DEFINE() builds a summary of free
+ * runs used to skip over full regions. After that the bits must only be
+ * changed through the sys_bitarray_*() functions, never by writing
+ * @c bundles directly, or the summary goes stale and allocations may
+ * fail or overlap.
+ *
  * @param[in]  bitarray Bitarray struct
  * @param[in]  num_bits Number of bits to allocate
  * @param[out] offset   Offset to the start of allocated region if
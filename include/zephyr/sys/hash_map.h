@@ -21,9 +21,12 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/hash_map_api.h>
+#include <zephyr/sys/hash_map_concurrent.h>
 #include <zephyr/sys/hash_map_cxx.h>
 #include <zephyr/sys/hash_map_oa_lp.h>
+#include <zephyr/sys/hash_map_rh.h>
 #include <zephyr/sys/hash_map_sc.h>
+#include <zephyr/sys/hash_map_swiss.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -0,0 +1,122 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Concurrent Hashmap Implementation
+ *
+ * A Separate Chaining Hashmap which may be used from several threads (and
+ * CPUs) at once. Buckets are guarded by a fixed number of spinlocks, or
+ * stripes, so that operations on keys of different stripes run in
+ * parallel. Resizing takes every stripe.
+ *
+ * Insertion, removal, lookup and clearing are safe against each other.
+ * Iteration is not safe against concurrent modification. The allocator is
+ * never called with a lock held, and the Hashmap cannot be used from user
+ * mode.
+ *
+ * @note Enable with @kconfig{CONFIG_SYS_HASH_MAP_CONCURRENT}
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HASH_MAP_CONCURRENT_H_
+#define ZEPHYR_INCLUDE_SYS_HASH_MAP_CONCURRENT_H_
+
+#include <stddef.h>
+
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/hash_function.h>
+#include <zephyr/sys/hash_map_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CONFIG_SYS_HASH_MAP_CONCURRENT
+struct sys_hashmap_concurrent_data {
+	void *buckets;
+	size_t n_buckets;
+	size_t size;
+	/* guards size, and n_buckets together with all stripes */
+	struct k_spinlock size_lock;
+	struct k_spinlock stripes[CONFIG_SYS_HASH_MAP_CONCURRENT_STRIPES];
+};
+#endif
+
+/**
+ * @brief Declare a Concurrent Hashmap (advanced)
+ *
+ * Declare a Concurrent Hashmap with control over advanced parameters.
+ *
+ * @note The allocator @p _alloc is used for allocating internal Hashmap
+ * entries and does not interact with any user-provided keys or values.
+ *
+ * @param _name Name of the Hashmap.
+ * @param _hash_func Hash function pointer of type @ref sys_hash_func32_t.
+ * @param _alloc_func Allocator function pointer of type @ref sys_hashmap_allocator_t.
+ * @param ... Variant-specific details for @ref sys_hashmap_config.
+ */
+#define SYS_HASHMAP_CONCURRENT_DEFINE_ADVANCED(_name, _hash_func, _alloc_func, ...)                \
+	SYS_HASHMAP_DEFINE_ADVANCED(_name, &sys_hashmap_concurrent_api, sys_hashmap_config,        \
+				    sys_hashmap_concurrent_data, _hash_func, _alloc_func, __VA_ARGS__)
+
+/**
+ * @brief Declare a Concurrent Hashmap (advanced)
+ *
+ * Declare a Concurrent Hashmap with control over advanced parameters.
+ *
+ * @note The allocator @p _alloc is used for allocating internal Hashmap
+ * entries and does not interact with any user-provided keys or values.
+ *
+ * @param _name Name of the Hashmap.
+ * @param _hash_func Hash function pointer of type @ref sys_hash_func32_t.
+ * @param _alloc_func Allocator function pointer of type @ref sys_hashmap_allocator_t.
+ * @param ... Details for @ref sys_hashmap_config.
+ */
+#define SYS_HASHMAP_CONCURRENT_DEFINE_STATIC_ADVANCED(_name, _hash_func, _alloc_func, ...)         \
+	SYS_HASHMAP_DEFINE_STATIC_ADVANCED(_name, &sys_hashmap_concurrent_api, sys_hashmap_config, \
+					   sys_hashmap_concurrent_data, _hash_func, _alloc_func,   \
+					   __VA_ARGS__)
+
+/**
+ * @brief Declare a Concurrent Hashmap statically
+ *
+ * Declare a Concurrent Hashmap statically with default parameters.
+ *
+ * @param _name Name of the Hashmap.
+ */
+#define SYS_HASHMAP_CONCURRENT_DEFINE_STATIC(_name)                                                \
+	SYS_HASHMAP_CONCURRENT_DEFINE_STATIC_ADVANCED(                                             \
+		_name, sys_hash32, SYS_HASHMAP_DEFAULT_ALLOCATOR,                                  \
+		SYS_HASHMAP_CONFIG(SIZE_MAX, SYS_HASHMAP_DEFAULT_LOAD_FACTOR))
+
+/**
+ * @brief Declare a Concurrent Hashmap
+ *
+ * Declare a Concurrent Hashmap with default parameters.
+ *
+ * @param _name Name of the Hashmap.
+ */
+#define SYS_HASHMAP_CONCURRENT_DEFINE(_name)                                                       \
+	SYS_HASHMAP_CONCURRENT_DEFINE_ADVANCED(                                                    \
+		_name, sys_hash32, SYS_HASHMAP_DEFAULT_ALLOCATOR,                                  \
+		SYS_HASHMAP_CONFIG(SIZE_MAX, SYS_HASHMAP_DEFAULT_LOAD_FACTOR))
+
+#ifdef CONFIG_SYS_HASH_MAP_CHOICE_CONCURRENT
+#define SYS_HASHMAP_DEFAULT_DEFINE(_name)	 SYS_HASHMAP_CONCURRENT_DEFINE(_name)
+#define SYS_HASHMAP_DEFAULT_DEFINE_STATIC(_name) SYS_HASHMAP_CONCURRENT_DEFINE_STATIC(_name)
+#define SYS_HASHMAP_DEFAULT_DEFINE_ADVANCED(_name, _hash_func, _alloc_func, ...)                   \
+	SYS_HASHMAP_CONCURRENT_DEFINE_ADVANCED(_name, _hash_func, _alloc_func, __VA_ARGS__)
+#define SYS_HASHMAP_DEFAULT_DEFINE_STATIC_ADVANCED(_name, _hash_func, _alloc_func, ...)            \
+	SYS_HASHMAP_CONCURRENT_DEFINE_STATIC_ADVANCED(_name, _hash_func, _alloc_func, __VA_ARGS__)
+#endif
+
+extern const struct sys_hashmap_api sys_hashmap_concurrent_api;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HASH_MAP_CONCURRENT_H_ */
@@ -128,6 +128,11 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+	struct {
+		/** Number of pages paged in ahead of a page fault */
+		unsigned long			cnt;
+	} read_ahead;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -504,6 +509,19 @@ __syscall void k_mem_paging_histogram_backing_store_page_in_get(
 __syscall void k_mem_paging_histogram_backing_store_page_out_get(
 	struct k_mem_paging_histogram_t *hist);
 
+/**
+ * Get the page fault timing histogram
+ *
+ * This populates the timing histogram struct being passed in
+ * as argument. Each page fault is accounted for with the total
+ * time taken to service it, using the backing store histogram
+ * bounds.
+ *
+ * @param[in,out] hist Timing histogram struct to be filled.
+ */
+__syscall void k_mem_paging_histogram_pagefault_get(
+	struct k_mem_paging_histogram_t *hist);
+
 #include <syscalls/mem_manage.h>
 
 /** @} */
@@ -92,6 +92,38 @@ int z_object_validate(struct z_object *ko, enum k_objects otype,
 extern void z_dump_object_error(int retval, const void *obj,
 				struct z_object *ko, enum k_objects otype);
 
+#ifdef CONFIG_SYSCALL_VALIDATION_CACHE
+/**
+ * Validate a kernel object, consulting the calling thread's cache first
+ *
+ * Same as looking up @p obj with z_object_find() and checking it with
+ * z_object_validate(), logging any failure, except that the lookup and
+ * permission check are skipped for objects the calling thread recently
+ * validated.
+ *
+ * @param obj Untrusted kernel object pointer
+ * @param otype Expected type of the kernel object, or K_OBJ_ANY
+ * @param init Expected initialization state of the object
+ * @return 0 If the object is valid, otherwise as z_object_validate()
+ */
+int z_object_validate_cached(const void *obj, enum k_objects otype,
+			     enum _obj_init_check init);
+
+/**
+ * Validate a memory buffer, consulting the calling thread's cache first
+ *
+ * Same as arch_buffer_validate(), except that buffers lying within one
+ * the calling thread recently validated for the same or stronger access
+ * are accepted without asking the architecture layer.
+ *
+ * @param addr Start address of the buffer
+ * @param size Size of the buffer
+ * @param write Whether write access is needed
+ * @return 0 If access is allowed, nonzero otherwise
+ */
+int z_buffer_validate_cached(void *addr, size_t size, int write);
+#endif /* CONFIG_SYSCALL_VALIDATION_CACHE */
+
 /**
  * Kernel object validation function
  *
@@ -329,6 +361,15 @@ extern int z_user_string_copy(char *dst, const char *src, size_t maxlen);
  */
 #define Z_SYSCALL_VERIFY(expr) Z_SYSCALL_VERIFY_MSG(expr, #expr)
 
+/* Buffer check used by Z_SYSCALL_MEMORY() */
+#ifdef CONFIG_SYSCALL_VALIDATION_CACHE
+#define Z_SYSCALL_BUFFER_VALIDATE(ptr, size, write) \
+	z_buffer_validate_cached((void *)ptr, size, write)
+#else
+#define Z_SYSCALL_BUFFER_VALIDATE(ptr, size, write) \
+	arch_buffer_validate((void *)ptr, size, write)
+#endif
+
 /**
  * @brief Runtime check that a user thread has read and/or write permission to
  *        a memory area
@@ -346,7 +387,7 @@ extern int z_user_string_copy(char *dst, const char *src, size_t maxlen);
  * @return 0 on success, nonzero on failure
  */
 #define Z_SYSCALL_MEMORY(ptr, size, write) \
-	Z_SYSCALL_VERIFY_MSG(arch_buffer_validate((void *)ptr, size, write) \
+	Z_SYSCALL_VERIFY_MSG(Z_SYSCALL_BUFFER_VALIDATE(ptr, size, write) \
 			     == 0, \
 			     "Memory region %p (size %zu) %s access denied", \
 			     (void *)(ptr), (size_t)(size), \
@@ -445,11 +486,18 @@ static inline int z_obj_validation_check(struct z_object *ko,
 	return ret;
 }
 
+#ifdef CONFIG_SYSCALL_VALIDATION_CACHE
+#define Z_SYSCALL_IS_OBJ(ptr, type, init) \
+	Z_SYSCALL_VERIFY_MSG(z_object_validate_cached(			\
+				     (const void *)ptr,			\
+				     type, init) == 0, "access denied")
+#else
 #define Z_SYSCALL_IS_OBJ(ptr, type, init) \
 	Z_SYSCALL_VERIFY_MSG(z_obj_validation_check(			\
 				     z_object_find((const void *)ptr),	\
 				     (const void *)ptr,			\
 				     type, init) == 0, "access denied")
+#endif
 
 /**
  * @brief Runtime check driver object pointer for presence of operation
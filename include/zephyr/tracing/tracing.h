@@ -1912,6 +1912,29 @@
 
 /** @} */ /* end of subsys_tracing_apis_event */
 
+/**
+ * @brief System Init Tracing APIs
+ * @defgroup subsys_tracing_apis_sys_init System Init Tracing APIs
+ * @{
+ */
+
+/**
+ * @brief Trace running a SYS_INIT or device init function entry.
+ * @param entry Init entry.
+ * @param level Init level.
+ */
+#define sys_port_trace_sys_init_enter(entry, level)
+
+/**
+ * @brief Trace running a SYS_INIT or device init function exit.
+ * @param entry Init entry.
+ * @param level Init level.
+ * @param result Return value of the init function.
+ */
+#define sys_port_trace_sys_init_exit(entry, level, result)
+
+/** @} */ /* end of subsys_tracing_apis_sys_init */
+
 /**
  * @brief System PM Tracing APIs
  * @defgroup subsys_tracing_apis_pm_system System PM Tracing APIs
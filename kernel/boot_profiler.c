@@ -0,0 +1,115 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/debug/boot_profiler.h>
+#include <kernel_internal.h>
+
+static struct boot_profiler_record records[CONFIG_BOOT_PROFILER_RECORDS];
+static atomic_t record_count;
+
+static const char *const level_names[] = {
+	"EARLY",
+	"PRE_KERNEL_1",
+	"PRE_KERNEL_2",
+	"POST_KERNEL",
+	"APPLICATION",
+	"SMP",
+};
+
+void z_boot_profiler_record(const struct init_entry *entry, uint8_t level,
+			    uint32_t start, uint32_t end, int result)
+{
+	/* Device init may run on several threads, see
+	 * CONFIG_DEVICE_INIT_PARALLEL
+	 */
+	atomic_val_t idx = atomic_inc(&record_count);
+	struct boot_profiler_record *rec;
+
+	if (idx >= ARRAY_SIZE(records)) {
+		return;
+	}
+
+	rec = &records[idx];
+	rec->entry = entry;
+	rec->start = start;
+	rec->end = end;
+	rec->result = (int16_t)CLAMP(result, INT16_MIN, INT16_MAX);
+	rec->level = level;
+}
+
+size_t boot_profiler_records_get(const struct boot_profiler_record **recs,
+				 size_t *dropped)
+{
+	size_t count = (size_t)atomic_get(&record_count);
+
+	*recs = records;
+	if (dropped != NULL) {
+		*dropped = count - MIN(count, ARRAY_SIZE(records));
+	}
+
+	return MIN(count, ARRAY_SIZE(records));
+}
+
+const char *boot_profiler_level_name(uint8_t level)
+{
+	if (level >= ARRAY_SIZE(level_names)) {
+		return "?";
+	}
+
+	return level_names[level];
+}
+
+int boot_profiler_record_format(const struct boot_profiler_record *rec,
+				char *buf, size_t len)
+{
+	const char *level;
+	uint32_t us;
+
+	if (rec == NULL) {
+		return snprintk(buf, len, "%-12s %10s  %s", "Level",
+				"Time (us)", "Init");
+	}
+
+	level = boot_profiler_level_name(rec->level);
+	us = k_cyc_to_us_ceil32(rec->end - rec->start);
+
+	if (rec->entry == NULL) {
+		return snprintk(buf, len, "%-12s %10u  total", level, us);
+	} else if (rec->entry->dev != NULL) {
+		return snprintk(buf, len, "%-12s %10u  device %s (%d)", level,
+				us, rec->entry->dev->name, rec->result);
+	} else {
+		return snprintk(buf, len, "%-12s %10u  sys_init %p (%d)", level,
+				us, (void *)rec->entry->init_fn.sys,
+				rec->result);
+	}
+}
+
+void boot_profiler_print(void)
+{
+	const struct boot_profiler_record *recs;
+	size_t count, dropped;
+	char line[BOOT_PROFILER_LINE_LEN];
+
+	count = boot_profiler_records_get(&recs, &dropped);
+
+	(void)boot_profiler_record_format(NULL, line, sizeof(line));
+	printk("%s\n", line);
+	for (size_t i = 0; i < count; i++) {
+		(void)boot_profiler_record_format(&recs[i], line, sizeof(line));
+		printk("%s\n", line);
+	}
+
+	if (dropped != 0) {
+		printk("%zu records dropped, increase "
+		       "CONFIG_BOOT_PROFILER_RECORDS\n", dropped);
+	}
+}
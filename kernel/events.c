@@ -39,11 +39,6 @@
 
 #define K_EVENT_WAIT_RESET    0x02   /* Reset events prior to waiting */
 
-struct event_walk_data {
-	struct k_thread  *head;
-	uint32_t events;
-};
-
 void z_impl_k_event_init(struct k_event *event)
 {
 	event->events = 0;
@@ -89,44 +84,14 @@ static bool are_wait_conditions_met(uint32_t desired, uint32_t current,
 	return match != 0;
 }
 
-static int event_walk_op(struct k_thread *thread, void *data)
-{
-	unsigned int      wait_condition;
-	struct event_walk_data *event_data = data;
-
-	wait_condition = thread->event_options & K_EVENT_WAIT_MASK;
-
-	if (are_wait_conditions_met(thread->events, event_data->events,
-				    wait_condition)) {
-
-		/*
-		 * Events create a list of threads to wake up. We do
-		 * not want z_thread_timeout to wake these threads; they
-		 * will be woken up by k_event_post_internal once they
-		 * have been processed.
-		 */
-		thread->no_wake_on_timeout = true;
-
-		/*
-		 * The wait conditions have been satisfied. Add this
-		 * thread to the list of threads to unpend.
-		 */
-		thread->next_event_link = event_data->head;
-		event_data->head = thread;
-		z_abort_timeout(&thread->base.timeout);
-	}
-
-	return 0;
-}
-
 static void k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
 {
 	k_spinlock_key_t  key;
 	struct k_thread  *thread;
-	struct event_walk_data data;
+	struct k_thread  *head = NULL;
+	struct z_sched_batch batch;
 
-	data.head = NULL;
 	key = k_spin_lock(&event->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_event, post, event, events,
@@ -135,31 +100,40 @@ static void k_event_post_internal(struct k_event *event, uint32_t events,
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
 	event->events = events;
-	data.events = events;
+
 	/*
 	 * Posting an event has the potential to wake multiple pended threads.
-	 * It is desirable to unpend all affected threads simultaneously. This
-	 * is done in three steps:
+	 * All affected threads are unpended in one scheduler batch:
 	 *
-	 * 1. Walk the waitq and create a linked list of threads to unpend.
-	 * 2. Unpend each of the threads in the linked list
-	 * 3. Ready each of the threads in the linked list
+	 * 1. Walk the waitq and create a linked list of threads to unpend
+	 *    (the waitq can't be modified while it is being walked).
+	 * 2. Wake each of the threads in the linked list.
+	 *
+	 * As the scheduler lock is held across both steps, a timeout can't
+	 * wake any of these threads in between.
 	 */
 
-	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
-
-	if (data.head != NULL) {
-		thread = data.head;
-		struct k_thread *next;
-		do {
-			arch_thread_return_value_set(thread, 0);
-			thread->events = events;
-			next = thread->next_event_link;
-			z_sched_wake_thread(thread, false);
-			thread = next;
-		} while (thread != NULL);
+	z_sched_batch_begin(&batch);
+
+	_WAIT_Q_FOR_EACH(&event->wait_q, thread) {
+		unsigned int wait_condition;
+
+		wait_condition = thread->event_options & K_EVENT_WAIT_MASK;
+
+		if (are_wait_conditions_met(thread->events, events,
+					    wait_condition)) {
+			thread->next_event_link = head;
+			head = thread;
+		}
 	}
 
+	for (thread = head; thread != NULL; thread = thread->next_event_link) {
+		thread->events = events;
+		z_sched_batch_wake(&batch, thread, 0, NULL);
+	}
+
+	(void)z_sched_batch_end(&batch);
+
 	z_reschedule(&event->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_event, post, event, events,
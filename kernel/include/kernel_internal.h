@@ -190,6 +190,18 @@ void z_mem_domain_exit_thread(struct k_thread *thread);
 extern struct k_spinlock z_mem_domain_lock;
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_SYSCALL_VALIDATION_CACHE
+/* Empty a new thread's syscall validation cache */
+void z_syscall_cache_init(struct k_thread *thread);
+
+/* Drop every thread's cached validation results. Must be called after
+ * any change that may take away access from a thread.
+ */
+void z_syscall_cache_invalidate(void);
+#else
+static inline void z_syscall_cache_invalidate(void) { }
+#endif
+
 #ifdef CONFIG_GDBSTUB
 struct gdb_ctx;
 
@@ -275,6 +287,23 @@ void pm_system_resume(void);
 
 #endif
 
+#ifdef CONFIG_BOOT_PROFILER
+struct init_entry;
+
+/**
+ * Record the timing of an init entry, or of a whole init level if
+ * @p entry is NULL, in the boot profile.
+ *
+ * @param entry Init entry, or NULL for an init level.
+ * @param level Init level.
+ * @param start Start timestamp, in hardware cycles.
+ * @param end End timestamp, in hardware cycles.
+ * @param result Value returned by the init function.
+ */
+void z_boot_profiler_record(const struct init_entry *entry, uint8_t level,
+			    uint32_t start, uint32_t end, int result);
+#endif /* CONFIG_BOOT_PROFILER */
+
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
 /**
  * Initialize the timing histograms for demand paging.
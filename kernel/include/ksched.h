@@ -138,6 +138,29 @@ static inline bool z_is_thread_queued(struct k_thread *thread)
 	return z_is_thread_state_set(thread, _THREAD_QUEUED);
 }
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+/* Unlocked snapshot for spin heuristics: true if @a thread is the
+ * current thread of some CPU.  May be stale by the time it returns.
+ */
+static inline bool z_is_thread_running(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Busy-wait budget of one adaptive spin, in 32 bit cycles */
+static inline uint32_t z_adaptive_spin_cycles(void)
+{
+	return k_us_to_cyc_ceil32(CONFIG_ADAPTIVE_SPIN_MAX_US);
+}
+#endif /* CONFIG_ADAPTIVE_SPIN */
+
 static inline void z_mark_thread_as_suspended(struct k_thread *thread)
 {
 	thread->base.thread_state |= _THREAD_SUSPENDED;
@@ -270,7 +293,10 @@ static ALWAYS_INLINE void z_sched_unlock_no_reschedule(void)
 
 static ALWAYS_INLINE bool z_is_thread_timeout_expired(struct k_thread *thread)
 {
-#ifdef CONFIG_SYS_CLOCK_EXISTS
+	/* Queues keeping absolute ticks in dticks may legitimately alias
+	 * _EXPIRED
+	 */
+#if defined(CONFIG_SYS_CLOCK_EXISTS) && defined(CONFIG_TIMEOUT_QUEUE_DLIST)
 	return thread->base.timeout.dticks == _EXPIRED;
 #else
 	return 0;
@@ -330,27 +356,57 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * All threads are unpended and made ready under a single hold of the
+ * scheduler lock, with one cache update and at most one IPI for the
+ * whole batch.
  *
- * @param wait_q Wait queue to wake up the highest prio thread
- * @param swap_retval Swap return value for woken thread
+ * @param wait_q Wait queue to wake up all threads of
+ * @param swap_retval Swap return value for woken threads
  * @param swap_data Data return value to supplement swap_retval. May be NULL.
- * @retval true If any threads were woken up
- * @retval false If the wait_q was empty
+ * @return Number of threads woken up
  */
-static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
-				    void *swap_data)
-{
-	bool woken = false;
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data);
 
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
+/* State of a batch wakeup, see z_sched_batch_begin() */
+struct z_sched_batch {
+	k_spinlock_key_t key;
+	int woken;
+};
 
-	/* True if we woke at least one thread up */
-	return woken;
-}
+/**
+ * Begin a batch wakeup
+ *
+ * Takes the scheduler lock so that any number of pended threads can be
+ * woken with z_sched_batch_wake(), paying for the cache update and the
+ * IPI only once in z_sched_batch_end().  In between, the caller may
+ * walk wait queues with _WAIT_Q_FOR_EACH() but must not call other
+ * scheduler APIs.
+ *
+ * @param batch Batch state, initialized by this call
+ */
+void z_sched_batch_begin(struct z_sched_batch *batch);
+
+/**
+ * Wake one pended thread as part of a batch
+ *
+ * @param batch Batch state from z_sched_batch_begin()
+ * @param thread Thread to unpend and make ready
+ * @param swap_retval Swap return value for the woken thread
+ * @param swap_data Data return value to supplement swap_retval. May be NULL.
+ */
+void z_sched_batch_wake(struct z_sched_batch *batch, struct k_thread *thread,
+			int swap_retval, void *swap_data);
+
+/**
+ * End a batch wakeup and release the scheduler lock
+ *
+ * As with z_sched_wake(), no reschedule is done; the caller is
+ * expected to call z_reschedule() if threads were woken.
+ *
+ * @param batch Batch state from z_sched_batch_begin()
+ * @return Number of threads woken up in the batch
+ */
+int z_sched_batch_end(struct z_sched_batch *batch);
 
 /**
  * Atomically put the current thread to sleep on a wait queue, with timeout
@@ -428,6 +484,18 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+/**
+ * @brief Note that a thread was made ready, for its wakeup latency
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+#else
+static inline void z_sched_usage_ready(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#endif
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
@@ -35,6 +35,7 @@
 #include <zephyr/timing/timing.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/pm/device_runtime.h>
+#include <zephyr/debug/boot_profiler.h>
 LOG_MODULE_REGISTER(os, CONFIG_KERNEL_LOG_LEVEL);
 
 
@@ -225,6 +226,175 @@ extern volatile uintptr_t __stack_chk_guard;
 __pinned_bss
 bool z_sys_post_kernel;
 
+/* Run the init function of a device and mark it initialized */
+static void device_init(const struct init_entry *entry, enum init_level level)
+{
+	const struct device *dev = entry->dev;
+	int rc = 0;
+
+#ifdef CONFIG_DEVICE_INIT_TIMING
+	uint32_t start = k_cycle_get_32();
+	uint32_t end;
+#endif
+
+	sys_port_trace_sys_init_enter(entry, level);
+
+	if (entry->init_fn.dev != NULL) {
+		rc = entry->init_fn.dev(dev);
+		/* Mark device initialized. If initialization
+		 * failed, record the error condition.
+		 */
+		if (rc != 0) {
+			if (rc < 0) {
+				rc = -rc;
+			}
+			if (rc > UINT8_MAX) {
+				rc = UINT8_MAX;
+			}
+			dev->state->init_res = rc;
+		}
+	}
+
+	sys_port_trace_sys_init_exit(entry, level, -(int)dev->state->init_res);
+
+#ifdef CONFIG_DEVICE_INIT_TIMING
+	end = k_cycle_get_32();
+	LOG_DBG("%s: init took %u us", dev->name,
+		k_cyc_to_us_ceil32(end - start));
+#ifdef CONFIG_BOOT_PROFILER
+	z_boot_profiler_record(entry, level, start, end,
+			       -(int)dev->state->init_res);
+#endif
+#endif /* CONFIG_DEVICE_INIT_TIMING */
+
+	dev->state->initialized = true;
+
+	if (rc == 0) {
+		/* Run automatic device runtime enablement */
+		(void)pm_device_runtime_auto_enable(dev);
+	}
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+static K_KERNEL_STACK_ARRAY_DEFINE(init_worker_stacks,
+				   CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_workers[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+
+/* A batch is a run of consecutive device init entries. Entries in
+ * [init_batch_start, init_batch_next) have been started, the rest are
+ * handed out in link order as their dependencies complete.
+ */
+static K_MUTEX_DEFINE(init_batch_lock);
+static K_CONDVAR_DEFINE(init_batch_cond);
+static const struct init_entry *init_batch_start;
+static const struct init_entry *init_batch_next;
+static const struct init_entry *init_batch_end;
+static enum init_level init_batch_level;
+
+static bool device_init_running(const struct device *dev)
+{
+	const struct init_entry *entry;
+
+	for (entry = init_batch_start; entry < init_batch_next; entry++) {
+		if (entry->dev == dev) {
+			return !dev->state->initialized;
+		}
+	}
+
+	return false;
+}
+
+static bool device_handles_running(const device_handle_t *handles,
+				   size_t count)
+{
+	for (size_t i = 0; (handles != NULL) && (i < count); i++) {
+		if (device_init_running(device_from_handle(handles[i]))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* A device may start once none of the devices it depends on is still
+ * being initialized. Dependencies in later batches or levels are ignored,
+ * as they would be when initializing serially.
+ */
+static bool device_init_ready(const struct device *dev)
+{
+	const device_handle_t *handles;
+	size_t count = 0;
+
+	handles = device_required_handles_get(dev, &count);
+	if (device_handles_running(handles, count)) {
+		return false;
+	}
+
+	handles = device_injected_handles_get(dev, &count);
+
+	return !device_handles_running(handles, count);
+}
+
+static void device_init_worker(void *p1, void *p2, void *p3)
+{
+	const struct init_entry *entry;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&init_batch_lock, K_FOREVER);
+	while (init_batch_next < init_batch_end) {
+		entry = init_batch_next;
+		if (!device_init_ready(entry->dev)) {
+			k_condvar_wait(&init_batch_cond, &init_batch_lock,
+				       K_FOREVER);
+			continue;
+		}
+		init_batch_next++;
+		k_mutex_unlock(&init_batch_lock);
+
+		device_init(entry, init_batch_level);
+
+		k_mutex_lock(&init_batch_lock, K_FOREVER);
+		k_condvar_broadcast(&init_batch_cond);
+	}
+	k_mutex_unlock(&init_batch_lock);
+}
+
+/* Initialize the devices in [start, end) on the calling thread and up to
+ * CONFIG_DEVICE_INIT_PARALLEL_THREADS helper threads. Returns once all of
+ * them are initialized.
+ */
+static void device_init_batch(const struct init_entry *start,
+			      const struct init_entry *end,
+			      enum init_level level)
+{
+	size_t workers = MIN((size_t)(end - start - 1),
+			     (size_t)CONFIG_DEVICE_INIT_PARALLEL_THREADS);
+
+	init_batch_level = level;
+	init_batch_start = start;
+	init_batch_next = start;
+	init_batch_end = end;
+
+	for (size_t i = 0; i < workers; i++) {
+		k_thread_create(&init_workers[i], init_worker_stacks[i],
+				K_KERNEL_STACK_SIZEOF(init_worker_stacks[i]),
+				device_init_worker, NULL, NULL, NULL,
+				CONFIG_MAIN_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&init_workers[i], "device_init");
+	}
+
+	device_init_worker(NULL, NULL, NULL);
+
+	for (size_t i = 0; i < workers; i++) {
+		k_thread_join(&init_workers[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -234,6 +404,11 @@ bool z_sys_post_kernel;
  * they need to be invoked, with symbols indicating where one level leaves
  * off and the next one begins.
  *
+ * With CONFIG_DEVICE_INIT_PARALLEL, runs of consecutive devices in the
+ * POST_KERNEL and later levels are initialized concurrently, only
+ * honoring their devicetree dependencies. SYS_INIT entries are still run
+ * alone, after everything linked before them.
+ *
  * @param level init level to run.
  */
 static void z_sys_init_run_level(enum init_level level)
@@ -252,38 +427,48 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
+#ifdef CONFIG_BOOT_PROFILER
+	uint32_t level_start = k_cycle_get_32();
+#endif
+
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
 		const struct device *dev = entry->dev;
 
 		if (dev != NULL) {
-			int rc = 0;
-
-			if (entry->init_fn.dev != NULL) {
-				rc = entry->init_fn.dev(dev);
-				/* Mark device initialized. If initialization
-				 * failed, record the error condition.
-				 */
-				if (rc != 0) {
-					if (rc < 0) {
-						rc = -rc;
-					}
-					if (rc > UINT8_MAX) {
-						rc = UINT8_MAX;
-					}
-					dev->state->init_res = rc;
-				}
-			}
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+			const struct init_entry *end = entry + 1;
 
-			dev->state->initialized = true;
+			while ((level >= INIT_LEVEL_POST_KERNEL) &&
+			       (end < levels[level+1]) && (end->dev != NULL)) {
+				end++;
+			}
 
-			if (rc == 0) {
-				/* Run automatic device runtime enablement */
-				(void)pm_device_runtime_auto_enable(dev);
+			if (end - entry > 1) {
+				device_init_batch(entry, end, level);
+				entry = end - 1;
+				continue;
 			}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+			device_init(entry, level);
 		} else {
-			(void)entry->init_fn.sys();
+#ifdef CONFIG_BOOT_PROFILER
+			uint32_t start = k_cycle_get_32();
+#endif
+			int rc;
+
+			sys_port_trace_sys_init_enter(entry, level);
+			rc = entry->init_fn.sys();
+			sys_port_trace_sys_init_exit(entry, level, rc);
+#ifdef CONFIG_BOOT_PROFILER
+			z_boot_profiler_record(entry, level, start,
+					       k_cycle_get_32(), rc);
+#endif
 		}
 	}
+
+#ifdef CONFIG_BOOT_PROFILER
+	z_boot_profiler_record(NULL, level, level_start, k_cycle_get_32(), 0);
+#endif
 }
 
 extern void boot_banner(void);
@@ -342,6 +527,10 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 	z_mem_manage_boot_finish();
 #endif /* CONFIG_MMU */
 
+#ifdef CONFIG_BOOT_PROFILER_PRINT
+	boot_profiler_print();
+#endif
+
 	extern int main(void);
 
 	(void)main();
@@ -10,9 +10,14 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <string.h>
 
 void k_heap_init(struct k_heap *h, void *mem, size_t bytes)
 {
+#ifdef CONFIG_HEAP_CPU_CACHE
+	(void)memset(h->cpu_cache, 0, sizeof(h->cpu_cache));
+	atomic_clear(&h->waiters);
+#endif
 	z_waitq_init(&h->wait_q);
 	sys_heap_init(&h->heap, mem, bytes);
 
@@ -61,12 +66,146 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+#ifdef CONFIG_HEAP_CPU_CACHE
+#define CACHE_CLASSES Z_HEAP_CPU_CACHE_CLASSES
+#define CACHE_MIN_SHIFT 4
+
+/* Size class serving a request of @a bytes, or -1 if it is not cacheable.
+ * Cached blocks come from plain sys_heap_alloc(), so only requests for
+ * at most pointer alignment (and no rewind, see z_heap_aligned_alloc())
+ * can use them.
+ */
+static int alloc_class(size_t align, size_t bytes)
+{
+	if ((bytes == 0U) || (bytes > CONFIG_HEAP_CPU_CACHE_MAX_SIZE) ||
+	    (align > sizeof(void *)) || ((align & (align - 1U)) != 0U)) {
+		return -1;
+	}
+
+	return (bytes <= BIT(CACHE_MIN_SHIFT)) ? 0 :
+		(int)LOG2CEIL(bytes) - CACHE_MIN_SHIFT;
+}
+
+/* Size class a freed block can be reused for: the largest class whose
+ * size fits in its usable size, or -1 if it is outside the cached range.
+ */
+static int free_class(struct k_heap *h, void *mem)
+{
+	size_t usable = sys_heap_usable_size(&h->heap, mem);
+	int cls;
+
+	if (usable < BIT(CACHE_MIN_SHIFT)) {
+		return -1;
+	}
+
+	cls = (int)LOG2(usable) - CACHE_MIN_SHIFT;
+
+	return (cls < CACHE_CLASSES) ? cls : -1;
+}
+
+/* The CPU is only a locality hint: each cache has its own lock, so being
+ * migrated after reading it is harmless.
+ */
+static inline struct k_heap_cpu_cache *local_cache(struct k_heap *h)
+{
+	return &h->cpu_cache[arch_curr_cpu()->id];
+}
+
+static void *cache_alloc(struct k_heap *h, int cls)
+{
+	struct k_heap_cpu_cache *cache = local_cache(h);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	void *mem = cache->free[cls];
+
+	if (mem != NULL) {
+		cache->free[cls] = *(void **)mem;
+		cache->count[cls]--;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return mem;
+}
+
+static bool cache_free(struct k_heap *h, void *mem)
+{
+	int cls = free_class(h, mem);
+	struct k_heap_cpu_cache *cache;
+	k_spinlock_key_t key;
+	bool cached = false;
+
+	if (cls < 0) {
+		return false;
+	}
+
+	cache = local_cache(h);
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count[cls] < CONFIG_HEAP_CPU_CACHE_DEPTH) {
+		*(void **)mem = cache->free[cls];
+		cache->free[cls] = mem;
+		cache->count[cls]++;
+		cached = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return cached;
+}
+
+/* Return every cached block to the heap.  Called with the heap lock
+ * held; returns true if anything was freed.
+ */
+static bool cache_flush(struct k_heap *h)
+{
+	bool flushed = false;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(h->cpu_cache); i++) {
+		struct k_heap_cpu_cache *cache = &h->cpu_cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		for (int cls = 0; cls < CACHE_CLASSES; cls++) {
+			while (cache->free[cls] != NULL) {
+				void *mem = cache->free[cls];
+
+				cache->free[cls] = *(void **)mem;
+				sys_heap_free(&h->heap, mem);
+				flushed = true;
+			}
+			cache->count[cls] = 0U;
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	return flushed;
+}
+#endif /* CONFIG_HEAP_CPU_CACHE */
+
 void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 			k_timeout_t timeout)
 {
 	int64_t now, end = sys_clock_timeout_end_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_HEAP_CPU_CACHE
+	int cls = alloc_class(align, bytes);
+	bool waiting = false;
+
+	if (cls >= 0) {
+		ret = cache_alloc(h, cls);
+		if (ret != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, h, timeout);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, h, timeout, ret);
+
+			return ret;
+		}
+
+		/* Allocate the whole class so the block is reusable for it */
+		bytes = BIT(cls + CACHE_MIN_SHIFT);
+	}
+#endif
+
 	end = K_TIMEOUT_EQ(timeout, K_FOREVER) ? INT64_MAX : end;
 
 	k_spinlock_key_t key = k_spin_lock(&h->lock);
@@ -80,6 +219,22 @@ void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 	while (ret == NULL) {
 		ret = sys_heap_aligned_alloc(&h->heap, align, bytes);
 
+#ifdef CONFIG_HEAP_CPU_CACHE
+		if (ret == NULL) {
+			/* Announce ourselves before flushing, so that a
+			 * concurrent cache_free() either lands before the
+			 * flush or sees us and takes the slow path.
+			 */
+			if (!waiting) {
+				waiting = true;
+				atomic_inc(&h->waiters);
+			}
+			if (cache_flush(h)) {
+				ret = sys_heap_aligned_alloc(&h->heap, align, bytes);
+			}
+		}
+#endif
+
 		now = sys_clock_tick_get();
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || ((end - now) <= 0)) {
@@ -101,6 +256,12 @@ void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 		key = k_spin_lock(&h->lock);
 	}
 
+#ifdef CONFIG_HEAP_CPU_CACHE
+	if (waiting) {
+		atomic_dec(&h->waiters);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, h, timeout, ret);
 
 	k_spin_unlock(&h->lock, key);
@@ -120,9 +281,27 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 
 void k_heap_free(struct k_heap *h, void *mem)
 {
+#ifdef CONFIG_HEAP_CPU_CACHE
+	bool cached = (mem != NULL) && cache_free(h, mem);
+
+	if (cached && (atomic_get(&h->waiters) == 0)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, h);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&h->lock);
 
+#ifdef CONFIG_HEAP_CPU_CACHE
+	if (cached) {
+		/* Someone is short of memory, give them everything */
+		(void)cache_flush(h);
+	} else {
+		sys_heap_free(&h->heap, mem);
+	}
+#else
 	sys_heap_free(&h->heap, mem);
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, h);
 	if (IS_ENABLED(CONFIG_MULTITHREADING) && z_unpend_all(&h->wait_q) != 0) {
@@ -249,6 +249,8 @@ int k_mem_domain_remove_partition(struct k_mem_domain *domain,
 
 	domain->num_partitions--;
 
+	z_syscall_cache_invalidate();
+
 unlock_out:
 	k_spin_unlock(&z_mem_domain_lock, key);
 
@@ -332,6 +334,9 @@ int k_mem_domain_add_thread(struct k_mem_domain *domain, k_tid_t thread)
 		if (ret == 0) {
 			ret = add_thread_locked(domain, thread);
 		}
+
+		/* The thread may lose access to its old partitions */
+		z_syscall_cache_invalidate();
 	}
 	k_spin_unlock(&z_mem_domain_lock, key);
 
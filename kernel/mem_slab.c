@@ -15,6 +15,7 @@
 #include <zephyr/init.h>
 #include <zephyr/sys/check.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <string.h>
 
 /**
  * @brief Initialize kernel memory slab subsystem.
@@ -87,6 +88,10 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->max_used = 0U;
 #endif
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	(void)memset(slab->cpu_cache, 0, sizeof(slab->cpu_cache));
+	atomic_clear(&slab->waiters);
+#endif
 
 	rc = create_free_list(slab);
 	if (rc < 0) {
@@ -101,11 +106,199 @@ out:
 	return rc;
 }
 
-int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+/* Hand @a block to the first waiter, or put it back on the shared free
+ * list.  Called with the slab lock held; returns true if a thread was
+ * readied and a reschedule is due.
+ */
+static bool free_locked(struct k_mem_slab *slab, char *block)
+{
+	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
+		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+		if (pending_thread != NULL) {
+			z_thread_return_value_set_with_data(pending_thread, 0, block);
+			z_ready_thread(pending_thread);
+			return true;
+		}
+	}
+	*(char **)block = slab->free_list;
+	slab->free_list = block;
+	slab->num_used--;
+
+	return false;
+}
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+#define CACHE_SIZE CONFIG_MEM_SLAB_CPU_CACHE_SIZE
+#define CACHE_BATCH (CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2)
+
+/* Take a block from the current CPU's magazine, refilling it from the
+ * shared free list when empty.  Returns NULL if both are empty.
+ */
+static char *cache_alloc(struct k_mem_slab *slab)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[arch_curr_cpu()->id];
+	k_spinlock_key_t cache_key = k_spin_lock(&cache->lock);
+	char *block = NULL;
+
+	if (cache->count == 0U) {
+		k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+		while ((cache->count < CACHE_BATCH) && (slab->free_list != NULL)) {
+			block = slab->free_list;
+			slab->free_list = *(char **)block;
+			*(char **)block = cache->free_list;
+			cache->free_list = block;
+			cache->count++;
+			slab->num_used++;
+		}
+
+		k_spin_unlock(&slab->lock, key);
+	}
+
+	if (cache->count != 0U) {
+		block = cache->free_list;
+		cache->free_list = *(char **)block;
+		cache->count--;
+	}
+
+	k_spin_unlock(&cache->lock, cache_key);
+	arch_irq_unlock(irq_key);
+
+	return block;
+}
+
+/* Put a block in the current CPU's magazine, draining part of it to the
+ * shared free list (or to waiters) when full.  Returns false without
+ * caching the block if a thread is waiting for one; the caller then
+ * hands it over directly.
+ */
+static bool cache_free(struct k_mem_slab *slab, char *block)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[arch_curr_cpu()->id];
+	k_spinlock_key_t cache_key = k_spin_lock(&cache->lock);
+	bool resched = false;
+
+	/* An allocator announces itself before flushing the magazines,
+	 * and flushing takes this lock, so either our block is flushed
+	 * or we see the allocator here.
+	 */
+	if (atomic_get(&slab->waiters) != 0) {
+		k_spin_unlock(&cache->lock, cache_key);
+		arch_irq_unlock(irq_key);
+
+		return false;
+	}
+
+	if (cache->count == CACHE_SIZE) {
+		k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+		while (cache->count > CACHE_BATCH) {
+			char *drained = cache->free_list;
+
+			cache->free_list = *(char **)drained;
+			cache->count--;
+			resched = free_locked(slab, drained) || resched;
+		}
+
+		k_spin_unlock(&slab->lock, key);
+	}
+
+	*(char **)block = cache->free_list;
+	cache->free_list = block;
+	cache->count++;
+
+	k_spin_unlock(&cache->lock, cache_key);
+	arch_irq_unlock(irq_key);
+
+	if (resched) {
+		z_reschedule_unlocked();
+	}
+
+	return true;
+}
+
+/* Return the blocks of every magazine to the shared free list, or to
+ * waiters.  Called without the slab lock held; returns true if a thread
+ * was readied and a reschedule is due.
+ */
+static bool cache_flush(struct k_mem_slab *slab)
+{
+	bool resched = false;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[i];
+		k_spinlock_key_t cache_key = k_spin_lock(&cache->lock);
+		k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+		while (cache->count != 0U) {
+			char *block = cache->free_list;
+
+			cache->free_list = *(char **)block;
+			cache->count--;
+			resched = free_locked(slab, block) || resched;
+		}
+
+		k_spin_unlock(&slab->lock, key);
+		k_spin_unlock(&cache->lock, cache_key);
+	}
+
+	return resched;
+}
+
+/* Must be called with the slab lock held, which keeps refills and
+ * drains from moving blocks while the magazines are summed.
+ */
+static uint32_t num_used_locked(struct k_mem_slab *slab)
+{
+	uint32_t cached = 0U;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		cached += slab->cpu_cache[i].count;
+	}
+
+	return slab->num_used - cached;
+}
+
+uint32_t z_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	uint32_t num_used = num_used_locked(slab);
+
+	k_spin_unlock(&slab->lock, key);
+
+	return num_used;
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	*mem = cache_alloc(slab);
+	if (*mem != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+
+	/* Announce ourselves before flushing, so that a concurrent
+	 * cache_free() either lands before the flush or sees us and
+	 * takes the slow path.  Only then may we fail or pend.
+	 */
+	atomic_inc(&slab->waiters);
+	if (cache_flush(slab)) {
+		z_reschedule_unlocked();
+	}
+#endif
+
+	key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
 	if (slab->free_list != NULL) {
@@ -132,6 +325,9 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 		if (result == 0) {
 			*mem = _current->base.swap_data;
 		}
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		atomic_dec(&slab->waiters);
+#endif
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
@@ -142,29 +338,35 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	k_spin_unlock(&slab->lock, key);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	atomic_dec(&slab->waiters);
+#endif
+
 	return result;
 }
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
-	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
-		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_free(slab, *mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
-		if (pending_thread != NULL) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif
 
-			z_thread_return_value_set_with_data(pending_thread, 0, *mem);
-			z_ready_thread(pending_thread);
-			z_reschedule(&slab->lock, key);
-			return;
-		}
+	key = k_spin_lock(&slab->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+	if (free_locked(slab, *mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		z_reschedule(&slab->lock, key);
+		return;
 	}
-	**(char ***) mem = slab->free_list;
-	slab->free_list = *(char **) mem;
-	slab->num_used--;
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
@@ -179,8 +381,14 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->num_used * slab->block_size;
-	stats->free_bytes = (slab->num_blocks - slab->num_used) * slab->block_size;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	uint32_t num_used = num_used_locked(slab);
+#else
+	uint32_t num_used = slab->num_used;
+#endif
+
+	stats->allocated_bytes = num_used * slab->block_size;
+	stats->free_bytes = (slab->num_blocks - num_used) * slab->block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->max_used * slab->block_size;
 #else
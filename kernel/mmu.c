@@ -671,6 +671,8 @@ void k_mem_unmap(void *addr, size_t size)
 	virt_region_free(pos, total_size);
 
 out:
+	/* User mappings may have gone away */
+	z_syscall_cache_invalidate();
 	k_spin_unlock(&z_mm_lock, key);
 }
 
@@ -959,6 +961,7 @@ struct k_mem_paging_stats_t paging_stats;
 extern struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_out;
+extern struct k_mem_paging_histogram_t z_paging_histogram_pagefault;
 #endif
 
 static inline void do_backing_store_page_in(uintptr_t location)
@@ -1092,7 +1095,14 @@ static int page_frame_prepare_locked(struct z_page_frame *pf, bool *dirty_ptr,
 		ret = k_mem_paging_backing_store_location_get(pf, location_ptr,
 							      page_fault);
 		if (ret != 0) {
-			LOG_ERR("out of backing store memory");
+			/* Other callers get -ENOMEM back, and write-back
+			 * runs into this routinely once the store is full
+			 */
+			if (page_fault) {
+				LOG_ERR("out of backing store memory");
+			} else {
+				LOG_DBG("out of backing store memory");
+			}
 			return -ENOMEM;
 		}
 		arch_mem_page_out(pf->addr, *location_ptr);
@@ -1298,6 +1308,18 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+static inline void paging_stats_read_ahead_inc(struct k_thread *faulting_thread)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.read_ahead.cnt++;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.read_ahead.cnt++;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
 static inline struct z_page_frame *do_eviction_select(bool *dirty)
 {
 	struct z_page_frame *pf;
@@ -1332,14 +1354,199 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_WRITEBACK
+BUILD_ASSERT(CONFIG_DEMAND_PAGING_WRITEBACK_LOW_WATERMARK <
+	     CONFIG_DEMAND_PAGING_WRITEBACK_HIGH_WATERMARK,
+	     "write-back low watermark must be below the high watermark");
+
+static K_KERNEL_PINNED_STACK_DEFINE(writeback_stack,
+				    CONFIG_DEMAND_PAGING_WRITEBACK_STACK_SIZE);
+static struct k_thread writeback_thread;
+static K_SEM_DEFINE(writeback_sem, 0, 1);
+
+/* Evict one data page picked by the eviction algorithm into the free page
+ * frame list, writing it back first if it is dirty. Returns false once the
+ * high watermark is reached or nothing more can be evicted.
+ */
+static bool writeback_evict_one(void)
+{
+	struct z_page_frame *pf;
+	uintptr_t location;
+	bool dirty, ret = false;
+	int key;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	key = irq_lock();
+	if (z_free_page_count >= CONFIG_DEMAND_PAGING_WRITEBACK_HIGH_WATERMARK) {
+		goto out;
+	}
+
+	pf = do_eviction_select(&dirty);
+	if (pf == NULL) {
+		goto out;
+	}
+
+	/* Don't dip into the backing store reserve of page faults, it is
+	 * fine for them to do the eviction themselves when it runs low.
+	 */
+	if (page_frame_prepare_locked(pf, &dirty, false, &location) != 0) {
+		goto out;
+	}
+	paging_stats_eviction_inc(_current, dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(location);
+	}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	key = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	page_frame_free_locked(pf);
+	ret = true;
+out:
+	irq_unlock(key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_unlock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	return ret;
+}
+
+static void writeback_thread_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&writeback_sem, K_FOREVER);
+
+		while (writeback_evict_one()) {
+			/* Refill up to the high watermark */
+		}
+	}
+}
+
+static int writeback_init(void)
+{
+	k_thread_create(&writeback_thread, writeback_stack,
+			K_KERNEL_STACK_SIZEOF(writeback_stack),
+			writeback_thread_entry, NULL, NULL, NULL,
+			CONFIG_DEMAND_PAGING_WRITEBACK_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&writeback_thread, "paging_writeback");
+
+	return 0;
+}
+
+SYS_INIT(writeback_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_DEMAND_PAGING_WRITEBACK */
+
+/* Bring the paged out data page at addr into a page frame, evicting
+ * another data page if there are no free page frames. Called with
+ * interrupts locked by *key, which may be unlocked and locked again while
+ * the backing store is accessed if CONFIG_DEMAND_PAGING_ALLOW_IRQ is set.
+ * Returns NULL if no page frame can be evicted.
+ */
+static struct z_page_frame *page_in_locked(void *addr,
+					   uintptr_t page_in_location,
+					   struct k_thread *faulting_thread,
+					   int *key)
+{
+	struct z_page_frame *pf;
+	uintptr_t page_out_location;
+	bool dirty = false;
+	int ret;
+
+	pf = free_page_frame_list_get();
+	if (pf == NULL) {
+		/* Need to evict a page frame */
+		pf = do_eviction_select(&dirty);
+		if (pf == NULL) {
+			return NULL;
+		}
+		LOG_DBG("evicting %p at 0x%lx", pf->addr,
+			z_page_frame_to_phys(pf));
+
+		paging_stats_eviction_inc(faulting_thread, dirty);
+	}
+	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
+	__ASSERT(ret == 0, "failed to prepare page frame");
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(*key);
+	/* Interrupts are now unlocked if they were not locked when we entered
+	 * this function, and we may service ISRs. The scheduler is still
+	 * locked.
+	 */
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(page_out_location);
+	}
+	do_backing_store_page_in(page_in_location);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	*key = irq_lock();
+	pf->flags &= ~Z_PAGE_FRAME_BUSY;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	pf->flags |= Z_PAGE_FRAME_MAPPED;
+	pf->addr = UINT_TO_POINTER(POINTER_TO_UINT(addr)
+				   & ~(CONFIG_MMU_PAGE_SIZE - 1));
+
+	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
+	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+
+	return pf;
+}
+
+#if CONFIG_BACKING_STORE_READ_AHEAD_PAGES > 0
+/* Page in the data pages following a faulting one, stopping at the first
+ * page that is not paged out. Pages read ahead are kept busy until all of
+ * them are in, so that read-ahead never evicts its own work.
+ */
+static void page_in_ahead(void *addr, struct k_thread *faulting_thread,
+			  int *key)
+{
+	struct z_page_frame *ahead[CONFIG_BACKING_STORE_READ_AHEAD_PAGES];
+	uint8_t *pos = UINT_TO_POINTER(POINTER_TO_UINT(addr)
+				       & ~(CONFIG_MMU_PAGE_SIZE - 1));
+	uintptr_t page_in_location;
+	int count;
+
+	for (count = 0; count < CONFIG_BACKING_STORE_READ_AHEAD_PAGES;
+	     count++) {
+		pos += CONFIG_MMU_PAGE_SIZE;
+		if (pos >= Z_VIRT_RAM_END ||
+		    arch_page_location_get(pos, &page_in_location) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		/* Best effort, every other frame may be pinned or busy */
+		ahead[count] = page_in_locked(pos, page_in_location,
+					      faulting_thread, key);
+		if (ahead[count] == NULL) {
+			break;
+		}
+		ahead[count]->flags |= Z_PAGE_FRAME_BUSY;
+		paging_stats_read_ahead_inc(faulting_thread);
+	}
+
+	while (count-- > 0) {
+		ahead[count]->flags &= ~Z_PAGE_FRAME_BUSY;
+	}
+}
+#endif /* CONFIG_BACKING_STORE_READ_AHEAD_PAGES > 0 */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct z_page_frame *pf;
-	int key, ret;
-	uintptr_t page_in_location, page_out_location;
+	int key;
+	uintptr_t page_in_location;
 	enum arch_page_location status;
 	bool result;
-	bool dirty = false;
 	struct k_thread *faulting_thread = _current_cpu->current;
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
@@ -1413,49 +1620,29 @@ static bool do_page_fault(void *addr, bool pin)
 
 	paging_stats_faults_inc(faulting_thread, key);
 
-	pf = free_page_frame_list_get();
-	if (pf == NULL) {
-		/* Need to evict a page frame */
-		pf = do_eviction_select(&dirty);
-		__ASSERT(pf != NULL, "failed to get a page frame");
-		LOG_DBG("evicting %p at 0x%lx", pf->addr,
-			z_page_frame_to_phys(pf));
-
-		paging_stats_eviction_inc(faulting_thread, dirty);
-	}
-	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
-	__ASSERT(ret == 0, "failed to prepare page frame");
-
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	irq_unlock(key);
-	/* Interrupts are now unlocked if they were not locked when we entered
-	 * this function, and we may service ISRs. The scheduler is still
-	 * locked.
-	 */
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
-	if (dirty) {
-		do_backing_store_page_out(page_out_location);
-	}
-	do_backing_store_page_in(page_in_location);
-
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	key = irq_lock();
-	pf->flags &= ~Z_PAGE_FRAME_BUSY;
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	pf = page_in_locked(addr, page_in_location, faulting_thread, &key);
+	__ASSERT(pf != NULL, "failed to get a page frame");
 	if (pin) {
 		pf->flags |= Z_PAGE_FRAME_PINNED;
 	}
-	pf->flags |= Z_PAGE_FRAME_MAPPED;
-	pf->addr = UINT_TO_POINTER(POINTER_TO_UINT(addr)
-				   & ~(CONFIG_MMU_PAGE_SIZE - 1));
-
-	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
-	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+#if CONFIG_BACKING_STORE_READ_AHEAD_PAGES > 0
+	/* The faulting access has not been retried yet, so the page is not
+	 * marked accessed. Keep read-ahead from evicting it.
+	 */
+	pf->flags |= Z_PAGE_FRAME_BUSY;
+	page_in_ahead(addr, faulting_thread, &key);
+	pf->flags &= ~Z_PAGE_FRAME_BUSY;
+#endif
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	k_sched_unlock();
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+#ifdef CONFIG_DEMAND_PAGING_WRITEBACK
+	if (z_free_page_count < CONFIG_DEMAND_PAGING_WRITEBACK_LOW_WATERMARK) {
+		k_sem_give(&writeback_sem);
+	}
+#endif /* CONFIG_DEMAND_PAGING_WRITEBACK */
 
 	return result;
 }
@@ -1496,7 +1683,36 @@ void k_mem_pin(void *addr, size_t size)
 
 bool z_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	bool ret;
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+	uint32_t time_diff;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+
+	time_start = timing_counter_get();
+#else
+	uint32_t time_start;
+
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	ret = do_page_fault(addr, false);
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_end = timing_counter_get();
+	time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
+#else
+	time_diff = k_cycle_get_32() - time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+
+	z_paging_histogram_inc(&z_paging_histogram_pagefault, time_diff);
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	return ret;
 }
 
 static void do_mem_unpin(void *addr)
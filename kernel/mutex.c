@@ -46,10 +46,19 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
  */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_SYNC_CONTENTION_STATS
+#define CONTENTION_INC(mutex, field) ((mutex)->contention.field++)
+#else
+#define CONTENTION_INC(mutex, field) do { } while (false)
+#endif
+
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
 	mutex->lock_count = 0U;
+#ifdef CONFIG_SYNC_CONTENTION_STATS
+	mutex->contention = (struct k_sync_contention_stats){ 0 };
+#endif
 
 	z_waitq_init(&mutex->wait_q);
 
@@ -92,6 +101,41 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+/* Called with the lock held on a mutex owned by another thread.
+ * Drops the lock and busy-waits while the owner keeps running on
+ * another CPU, for at most CONFIG_ADAPTIVE_SPIN_MAX_US.  Returns
+ * with the lock held again, true if the mutex is now free.
+ *
+ * Waiters get the mutex handed over directly on unlock, so there is
+ * no point in spinning behind them.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	struct k_thread *owner = mutex->owner;
+	uint32_t budget = z_adaptive_spin_cycles();
+	uint32_t start;
+
+	if ((z_waitq_head(&mutex->wait_q) != NULL) ||
+	    !z_is_thread_running(owner)) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	start = k_cycle_get_32();
+	while ((mutex->owner == owner) && z_is_thread_running(owner) &&
+	       ((k_cycle_get_32() - start) < budget)) {
+		compiler_barrier();
+		arch_nop();
+	}
+
+	*key = k_spin_lock(&lock);
+
+	return mutex->lock_count == 0U;
+}
+#endif /* CONFIG_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -132,8 +176,30 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+	CONTENTION_INC(mutex, contended);
+
+#ifdef CONFIG_ADAPTIVE_SPIN
+	if (mutex_spin(mutex, &key)) {
+		CONTENTION_INC(mutex, spin_acquired);
+
+		mutex->owner_orig_prio = _current->base.prio;
+		mutex->lock_count = 1U;
+		mutex->owner = _current;
+
+		LOG_DBG("%p took mutex %p after spinning", _current, mutex);
+
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
+	CONTENTION_INC(mutex, pended);
+
 	new_prio = new_prio_for_inheritance(_current->base.prio,
 					    mutex->owner->base.prio);
 
@@ -281,3 +347,21 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 }
 #include <syscalls/k_mutex_unlock_mrsh.c>
 #endif
+
+#ifdef CONFIG_SYNC_CONTENTION_STATS
+int k_mutex_contention_stats_get(struct k_mutex *mutex,
+				 struct k_sync_contention_stats *stats)
+{
+	if ((mutex == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = mutex->contention;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SYNC_CONTENTION_STATS */
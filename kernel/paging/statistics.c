@@ -16,6 +16,7 @@ extern struct k_mem_paging_stats_t paging_stats;
 struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
 struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_out;
+struct k_mem_paging_histogram_t z_paging_histogram_pagefault;
 
 #ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
 
@@ -57,7 +58,8 @@ k_mem_paging_eviction_histogram_bounds[CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM_NUM
 
 /*
  * This provides the upper bounds of the bins in backing store timing histogram
- * (both page-in and page-out).
+ * (both page-in and page-out). The page fault timing histogram uses the same
+ * bounds, as servicing a page fault is dominated by backing store accesses.
  */
 __weak unsigned long
 k_mem_paging_backing_store_histogram_bounds[
@@ -160,6 +162,12 @@ void z_paging_histogram_init(void)
 	memcpy(z_paging_histogram_backing_store_page_out.bounds,
 	       k_mem_paging_backing_store_histogram_bounds,
 	       sizeof(z_paging_histogram_backing_store_page_out.bounds));
+
+	memset(&z_paging_histogram_pagefault, 0,
+	       sizeof(z_paging_histogram_pagefault));
+	memcpy(z_paging_histogram_pagefault.bounds,
+	       k_mem_paging_backing_store_histogram_bounds,
+	       sizeof(z_paging_histogram_pagefault.bounds));
 }
 
 /**
@@ -219,6 +227,18 @@ void z_impl_k_mem_paging_histogram_backing_store_page_out_get(
 	       sizeof(z_paging_histogram_backing_store_page_out));
 }
 
+void z_impl_k_mem_paging_histogram_pagefault_get(
+	struct k_mem_paging_histogram_t *hist)
+{
+	if (hist == NULL) {
+		return;
+	}
+
+	/* Copy histogram */
+	memcpy(hist, &z_paging_histogram_pagefault,
+	       sizeof(z_paging_histogram_pagefault));
+}
+
 #ifdef CONFIG_USERSPACE
 static inline
 void z_vrfy_k_mem_paging_histogram_eviction_get(
@@ -246,6 +266,15 @@ void z_vrfy_k_mem_paging_histogram_backing_store_page_out_get(
 	z_impl_k_mem_paging_histogram_backing_store_page_out_get(hist);
 }
 #include <syscalls/k_mem_paging_histogram_backing_store_page_out_get_mrsh.c>
+
+static inline
+void z_vrfy_k_mem_paging_histogram_pagefault_get(
+	struct k_mem_paging_histogram_t *hist)
+{
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(hist, sizeof(*hist)));
+	z_impl_k_mem_paging_histogram_pagefault_get(hist);
+}
+#include <syscalls/k_mem_paging_histogram_pagefault_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
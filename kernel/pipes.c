@@ -48,6 +48,11 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&pipe->poll_events);
+#endif
+#ifdef CONFIG_PIPES_CLAIM
+	pipe->put_claimed = 0U;
+	pipe->get_claimed = 0U;
+	pipe->watermark = 0U;
 #endif
 	z_object_init(pipe);
 }
@@ -97,6 +102,49 @@ static inline void handle_poll_events(struct k_pipe *pipe)
 #endif
 }
 
+/**
+ * @brief Check whether the pipe buffer may be written by copying
+ *
+ * Space claimed in place must be committed first.
+ */
+static inline bool pipe_buffer_writable(struct k_pipe *pipe)
+{
+#ifdef CONFIG_PIPES_CLAIM
+	if (pipe->put_claimed != 0U) {
+		return false;
+	}
+#endif
+	return pipe->bytes_used != pipe->size;
+}
+
+/**
+ * @brief Check whether the pipe buffer may be read by copying
+ *
+ * Data claimed in place must be released first.
+ */
+static inline bool pipe_buffer_readable(struct k_pipe *pipe)
+{
+#ifdef CONFIG_PIPES_CLAIM
+	if (pipe->get_claimed != 0U) {
+		return false;
+	}
+#endif
+	return pipe->bytes_used != 0U;
+}
+
+/**
+ * @brief Check whether enough data is buffered to wake readers
+ */
+static inline bool pipe_above_watermark(struct k_pipe *pipe)
+{
+#ifdef CONFIG_PIPES_CLAIM
+	return (pipe->bytes_used != 0U) &&
+	       (pipe->bytes_used >= pipe->watermark);
+#else
+	return pipe->bytes_used != 0U;
+#endif
+}
+
 void z_impl_k_pipe_flush(struct k_pipe *pipe)
 {
 	size_t  bytes_read;
@@ -176,6 +224,10 @@ int k_pipe_cleanup(struct k_pipe *pipe)
 		pipe->bytes_used = 0U;
 		pipe->read_index = 0U;
 		pipe->write_index = 0U;
+#ifdef CONFIG_PIPES_CLAIM
+		pipe->put_claimed = 0U;
+		pipe->get_claimed = 0U;
+#endif
 		pipe->flags &= ~K_PIPE_FLAG_ALLOC;
 	}
 
@@ -338,6 +390,17 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 		src->buffer         += bytes_copied;
 		src->bytes_to_xfer  -= bytes_copied;
 
+		if (src->thread == NULL) {
+
+			/* Reading from the pipe buffer. Update details. */
+
+			pipe->bytes_used -= bytes_copied;
+			pipe->read_index += bytes_copied;
+			if (pipe->read_index >= pipe->size) {
+				pipe->read_index -= pipe->size;
+			}
+		}
+
 		if (dest->thread == NULL) {
 
 			/* Writing to the pipe buffer. Update details. */
@@ -407,7 +470,7 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 						    &pipe->wait_q.readers,
 						    bytes_to_write);
 
-	if (pipe->bytes_used != pipe->size) {
+	if (pipe_buffer_writable(pipe)) {
 		bytes_can_write += pipe_buffer_list_populate(&dest_list,
 							     pipe_desc,
 							     pipe->buffer,
@@ -450,7 +513,7 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 	 * there are bytes remaining after any pending readers have read from it
 	 */
 
-	if ((pipe->bytes_used != 0U) && (*bytes_written != 0U)) {
+	if (pipe_above_watermark(pipe) && (*bytes_written != 0U)) {
 		handle_poll_events(pipe);
 	}
 
@@ -520,6 +583,34 @@ int z_vrfy_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 #include <syscalls/k_pipe_put_mrsh.c>
 #endif
 
+/**
+ * @brief Refill the pipe buffer from waiting writers, if it is not full
+ */
+static void pipe_refill(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc   pipe_desc[2];
+	sys_dlist_t         src_list;
+	sys_dlist_t         pipe_list;
+
+	if (!pipe_buffer_writable(pipe)) {
+		return;
+	}
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&pipe_list);
+
+	(void) pipe_waiter_list_populate(&src_list,
+					 &pipe->wait_q.writers,
+					 pipe->size - pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->write_index,
+					 pipe->read_index);
+
+	(void) pipe_write(pipe, &src_list, &pipe_list, reschedule);
+}
+
 static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 			     void *data, size_t bytes_to_read,
 			     size_t *bytes_read, size_t min_xfer,
@@ -544,7 +635,7 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 	sys_dlist_init(&src_list);
 
-	if (pipe->bytes_used != 0) {
+	if (pipe_buffer_readable(pipe)) {
 		bytes_can_read = pipe_buffer_list_populate(&src_list,
 							   pipe_desc,
 							   pipe->buffer,
@@ -617,29 +708,7 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	}
 
-	if (pipe->bytes_used != pipe->size) {
-		sys_dlist_t         pipe_list;
-
-		/*
-		 * The pipe is not full. If there are any waiting writers,
-		 * refill the pipe.
-		 */
-
-		sys_dlist_init(&src_list);
-		sys_dlist_init(&pipe_list);
-
-		(void) pipe_waiter_list_populate(&src_list,
-						 &pipe->wait_q.writers,
-						 pipe->size - pipe->bytes_used);
-
-		(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
-						 pipe->buffer, pipe->size,
-						 pipe->write_index,
-						 pipe->read_index);
-
-		(void) pipe_write(pipe, &src_list,
-				  &pipe_list, &reschedule_needed);
-	}
+	pipe_refill(pipe, &reschedule_needed);
 
 	/*
 	 * The immediate success conditions below are backwards
@@ -749,6 +818,11 @@ size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 		res = pipe->size - (pipe->read_index - pipe->write_index);
 	}
 
+#ifdef CONFIG_PIPES_CLAIM
+	/* Data claimed in place is not available until released */
+	res -= pipe->get_claimed;
+#endif
+
 	k_spin_unlock(&pipe->lock, key);
 
 out:
@@ -786,6 +860,11 @@ size_t z_impl_k_pipe_write_avail(struct k_pipe *pipe)
 		res = pipe->size - (pipe->write_index - pipe->read_index);
 	}
 
+#ifdef CONFIG_PIPES_CLAIM
+	/* Space claimed in place is not available until committed */
+	res -= pipe->put_claimed;
+#endif
+
 	k_spin_unlock(&pipe->lock, key);
 
 out:
@@ -801,3 +880,195 @@ size_t z_vrfy_k_pipe_write_avail(struct k_pipe *pipe)
 }
 #include <syscalls/k_pipe_write_avail_mrsh.c>
 #endif
+
+#ifdef CONFIG_PIPES_CLAIM
+/**
+ * @brief Hand buffered data to waiting readers and pollers
+ *
+ * Only done once the watermark is reached.
+ */
+static void pipe_wake_readers(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc   pipe_desc[2];
+	sys_dlist_t         src_list;
+	sys_dlist_t         dest_list;
+	size_t              bytes_can_read;
+
+	if (!pipe_above_watermark(pipe)) {
+		return;
+	}
+
+	if (pipe_buffer_readable(pipe)) {
+		sys_dlist_init(&src_list);
+		sys_dlist_init(&dest_list);
+
+		bytes_can_read = pipe_buffer_list_populate(&src_list, pipe_desc,
+							   pipe->buffer,
+							   pipe->size,
+							   pipe->read_index,
+							   pipe->write_index);
+
+		(void) pipe_waiter_list_populate(&dest_list,
+						 &pipe->wait_q.readers,
+						 bytes_can_read);
+
+		(void) pipe_write(pipe, &src_list, &dest_list, reschedule);
+	}
+
+	if (pipe->bytes_used != 0U) {
+		handle_poll_events(pipe);
+		*reschedule = true;
+	}
+}
+
+size_t k_pipe_put_claim(struct k_pipe *pipe, uint8_t **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t start;
+	size_t space;
+
+	if (pipe->buffer == NULL) {
+		k_spin_unlock(&pipe->lock, key);
+		*data = NULL;
+		return 0;
+	}
+
+	start = pipe->write_index + pipe->put_claimed;
+	if (start >= pipe->size) {
+		start -= pipe->size;
+	}
+
+	/* Contiguous free space following the current claim */
+	space = MIN(pipe->size - pipe->bytes_used - pipe->put_claimed,
+		    pipe->size - start);
+	size = MIN(size, space);
+
+	pipe->put_claimed += size;
+	*data = &pipe->buffer[start];
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return size;
+}
+
+int k_pipe_put_commit(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool reschedule_needed = false;
+
+	CHECKIF(size > pipe->put_claimed) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->put_claimed = 0U;
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	if (size != 0U) {
+		pipe_wake_readers(pipe, &reschedule_needed);
+	}
+
+	/* Writers blocked on the claim may now use what is left of it */
+	pipe_refill(pipe, &reschedule_needed);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+size_t k_pipe_get_claim(struct k_pipe *pipe, uint8_t **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t start;
+	size_t avail;
+
+	if (pipe->buffer == NULL) {
+		k_spin_unlock(&pipe->lock, key);
+		*data = NULL;
+		return 0;
+	}
+
+	start = pipe->read_index + pipe->get_claimed;
+	if (start >= pipe->size) {
+		start -= pipe->size;
+	}
+
+	/* Contiguous data following the current claim */
+	avail = MIN(pipe->bytes_used - pipe->get_claimed, pipe->size - start);
+	size = MIN(size, avail);
+
+	pipe->get_claimed += size;
+	*data = &pipe->buffer[start];
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return size;
+}
+
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool reschedule_needed = false;
+
+	CHECKIF(size > pipe->get_claimed) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->get_claimed = 0U;
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+
+	/* Waiting writers fill the space freed */
+	pipe_refill(pipe, &reschedule_needed);
+
+	/* Readers blocked on the claim may now read what is left of it */
+	pipe_wake_readers(pipe, &reschedule_needed);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+int k_pipe_watermark_set(struct k_pipe *pipe, size_t watermark)
+{
+	k_spinlock_key_t key;
+	bool reschedule_needed = false;
+
+	CHECKIF(watermark > pipe->size) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	pipe->watermark = watermark;
+
+	/* Lowering the watermark may release buffered data */
+	pipe_wake_readers(pipe, &reschedule_needed);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_PIPES_CLAIM */
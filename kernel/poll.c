@@ -34,10 +34,13 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+#ifdef CONFIG_POLL_SET
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
+#endif
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -87,11 +90,21 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 #ifdef CONFIG_PIPES
-	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
-		if (k_pipe_read_avail(event->pipe)) {
+	case K_POLL_TYPE_PIPE_DATA_AVAILABLE: {
+		size_t avail = k_pipe_read_avail(event->pipe);
+
+#ifdef CONFIG_PIPES_CLAIM
+		/* Pollers are only signalled once the watermark is reached */
+		if (avail < event->pipe->watermark) {
+			avail = 0U;
+		}
+#endif
+		if (avail != 0U) {
 			*state = K_POLL_STATE_PIPE_DATA_AVAILABLE;
 			return true;
 		}
+		break;
+	}
 #endif
 	case K_POLL_TYPE_IGNORE:
 		break;
@@ -108,22 +121,30 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread of their own and rank after all threads. */
+static inline bool poller_is_set(struct z_poller *p)
+{
+	return IS_ENABLED(CONFIG_POLL_SET) && (p->mode == MODE_SET);
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || poller_is_set(poller) ||
+		(!poller_is_set(pending->poller) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+							   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (poller_is_set(pending->poller) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+				      poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -447,6 +468,12 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	int retcode = 0;
 
 	if (poller != NULL) {
+#ifdef CONFIG_POLL_SET
+		/* Set events stay registered to their set */
+		if (poller->mode == MODE_SET) {
+			return signal_poll_set(event, state);
+		}
+#endif
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
@@ -813,3 +840,169 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+#ifdef CONFIG_POLL_SET
+static inline struct k_poll_set *poller_set(struct z_poller *poller)
+{
+	return CONTAINER_OF(poller, struct k_poll_set, poller);
+}
+
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = poller_set(event->poller);
+
+	/* The object dropped the event from its list: move it to the ready
+	 * list, where the next wait finds it.
+	 */
+	event->state = state;
+	sys_dlist_append(&set->ready, &event->_node);
+	(void)z_sched_wake(&set->wait_q, 0, NULL);
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static int poll_set_collect(struct k_poll_set *set,
+			    struct k_poll_event **ready, int max_events)
+{
+	sys_dlist_t reported;
+	sys_dnode_t *node;
+	int num = 0;
+
+	sys_dlist_init(&reported);
+
+	while ((num < max_events) &&
+	       ((node = sys_dlist_get(&set->ready)) != NULL)) {
+		struct k_poll_event *event =
+			CONTAINER_OF(node, struct k_poll_event, _node);
+		uint32_t state;
+
+		if (is_condition_met(event, &state)) {
+			/* Level triggered: check it again on the next wait */
+			event->state = state;
+			ready[num++] = event;
+			sys_dlist_append(&reported, node);
+		} else {
+			/* Cancellation is reported once, consumed or spurious
+			 * signals are not reported.
+			 */
+			if ((event->state & K_POLL_STATE_CANCELLED) != 0U) {
+				event->state = K_POLL_STATE_CANCELLED;
+				ready[num++] = event;
+			} else {
+				event->state = K_POLL_STATE_NOT_READY;
+			}
+			register_event(event, &set->poller);
+		}
+	}
+
+	/* Rotate reported events behind the others, for fairness. */
+	while ((node = sys_dlist_get(&reported)) != NULL) {
+		sys_dlist_append(&set->ready, node);
+	}
+
+	return num;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key;
+	uint32_t state;
+
+	__ASSERT(set != NULL, "NULL set\n");
+	__ASSERT(event != NULL, "NULL event\n");
+
+	key = k_spin_lock(&lock);
+
+	if (is_condition_met(event, &state)) {
+		event->poller = &set->poller;
+		event->state = state;
+		sys_dlist_append(&set->ready, &event->_node);
+		if (z_sched_wake(&set->wait_q, 0, NULL)) {
+			z_reschedule(&lock, key);
+			return;
+		}
+	} else {
+		event->state = K_POLL_STATE_NOT_READY;
+		register_event(event, &set->poller);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	__ASSERT(set != NULL, "NULL set\n");
+	__ASSERT(event != NULL, "NULL event\n");
+
+	key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		ret = -EINVAL;
+	} else {
+		/* On either its object's list or the ready list, except
+		 * for ignored events whose node is never initialized
+		 */
+		if ((event->type != K_POLL_TYPE_IGNORE) &&
+		    sys_dnode_is_linked(&event->_node)) {
+			sys_dlist_remove(&event->_node);
+		}
+		event->poller = NULL;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_events, k_timeout_t timeout)
+{
+	int64_t end = sys_clock_timeout_end_calc(timeout);
+	k_spinlock_key_t key;
+	int num;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(set != NULL, "NULL set\n");
+	__ASSERT((ready != NULL) && (max_events > 0), "no room for events\n");
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		num = poll_set_collect(set, ready, max_events);
+		if ((num > 0) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		(void)z_pend_curr(&lock, key, &set->wait_q, timeout);
+
+		/* Another waiter may have taken the events, so wait again
+		 * for what is left of the timeout.
+		 */
+		if (!K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+			int64_t remaining = end - sys_clock_tick_get();
+
+			timeout = (remaining > 0) ? Z_TIMEOUT_TICKS(remaining)
+						  : K_NO_WAIT;
+		}
+
+		key = k_spin_lock(&lock);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return (num > 0) ? num : -EAGAIN;
+}
+#endif /* CONFIG_POLL_SET */
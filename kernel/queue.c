@@ -91,6 +91,29 @@ static inline void handle_poll_events(struct k_queue *queue, uint32_t state)
 #endif
 }
 
+/* True if an insert can skip the wait queue and the reschedule: no
+ * thread is waiting for data and no poller is registered.  Called
+ * with the queue lock held.  Threads only start to wait with that
+ * lock held, so an empty wait queue stays empty until it is released;
+ * a waiter concurrently timing out at most sends us down the slow
+ * path.  Pollers register under the poll lock instead, so the poll
+ * events must still be handled after the insert on the fast path.
+ */
+static inline bool queue_fast_path(struct k_queue *queue)
+{
+#ifdef CONFIG_QUEUE_FAST_PATH
+#ifdef CONFIG_POLL
+	if (!sys_dlist_is_empty(&queue->poll_events)) {
+		return false;
+	}
+#endif
+	return z_waitq_head(&queue->wait_q) == NULL;
+#else
+	ARG_UNUSED(queue);
+	return false;
+#endif
+}
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, cancel_wait, queue);
@@ -120,15 +143,18 @@ static inline void z_vrfy_k_queue_cancel_wait(struct k_queue *queue)
 static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 			    bool alloc, bool is_append)
 {
-	struct k_thread *first_pending_thread;
+	struct k_thread *first_pending_thread = NULL;
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	bool fast = queue_fast_path(queue);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
 
 	if (is_append) {
 		prev = sys_sflist_peek_tail(&queue->data_q);
 	}
-	first_pending_thread = z_unpend_first_thread(&queue->wait_q);
+	if (!fast) {
+		first_pending_thread = z_unpend_first_thread(&queue->wait_q);
+	}
 
 	if (first_pending_thread != NULL) {
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, queue_insert, queue, alloc, K_FOREVER);
@@ -165,7 +191,11 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 
 	sys_sflist_insert(&queue->data_q, prev, data);
 	handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
-	z_reschedule(&queue->lock, key);
+	if (fast) {
+		k_spin_unlock(&queue->lock, key);
+	} else {
+		z_reschedule(&queue->lock, key);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, queue_insert, queue, alloc, 0);
 
@@ -254,8 +284,9 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *thread = NULL;
+	bool fast = queue_fast_path(queue);
 
-	if (head != NULL) {
+	if ((head != NULL) && !fast) {
 		thread = z_unpend_first_thread(&queue->wait_q);
 	}
 
@@ -272,6 +303,11 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append_list, queue, 0);
 
 	handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+	if (fast) {
+		k_spin_unlock(&queue->lock, key);
+		return 0;
+	}
+
 	z_reschedule(&queue->lock, key);
 	return 0;
 }
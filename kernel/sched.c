@@ -213,6 +213,12 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	/* A thread is queued on the CPU it last ran on.  base.cpu is
+	 * only updated when the thread is switched in, i.e. never
+	 * while it sits in a run queue.
+	 */
+	return &_kernel.cpus[thread->base.cpu].ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
 #endif
@@ -220,7 +226,7 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
@@ -237,10 +243,40 @@ static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 	_priq_run_remove(thread_runq(thread), thread);
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+/* Best thread of the local run queue, unless another CPU has queued a
+ * thread of strictly higher priority, which is then stolen.  This
+ * keeps the scheduling decision identical to the one made with a
+ * single global queue while preferring local threads on ties.
+ */
+static ALWAYS_INLINE struct k_thread *runq_best(void)
+{
+	struct k_thread *thread = _priq_run_best(curr_cpu_runq());
+	unsigned int currcpu = arch_curr_cpu()->id;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *remote;
+
+		if (i == currcpu) {
+			continue;
+		}
+
+		remote = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if ((remote != NULL) &&
+		    ((thread == NULL) || (z_sched_prio_cmp(remote, thread) > 0))) {
+			thread = remote;
+		}
+	}
+
+	return thread;
+}
+#else
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
 	return _priq_run_best(curr_cpu_runq());
 }
+#endif
 
 /* _current is never in the run queue until context switch on
  * SMP configurations, see z_requeue_current()
@@ -609,6 +645,7 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+		z_sched_usage_ready(thread);
 		queue_thread(thread);
 		update_cache(0);
 		flag_ipi();
@@ -781,16 +818,6 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
 		bool killed = ((thread->base.thread_state & _THREAD_DEAD) ||
 			       (thread->base.thread_state & _THREAD_ABORTING));
 
-#ifdef CONFIG_EVENTS
-		bool do_nothing = thread->no_wake_on_timeout && is_timeout;
-
-		thread->no_wake_on_timeout = false;
-
-		if (do_nothing) {
-			continue;
-		}
-#endif
-
 		if (!killed) {
 			/* The thread is not being killed */
 			if (thread->base.pended_on != NULL) {
@@ -1038,6 +1065,9 @@ struct k_thread *z_swap_next_thread(void)
 static inline void set_current(struct k_thread *new_thread)
 {
 	z_thread_mark_switched_out();
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	new_thread->base.cpu = _current_cpu->id;
+#endif
 	_current_cpu->current = new_thread;
 }
 
@@ -1267,18 +1297,36 @@ struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 	return thread;
 }
 
+/* Unpend and queue one thread of a batch wakeup, leaving the cache
+ * update and IPI to the end of the batch.  Must be called with the
+ * scheduler lock held.
+ */
+static void batch_ready_thread(struct k_thread *thread)
+{
+	unpend_thread_no_timeout(thread);
+	(void)z_abort_thread_timeout(thread);
+
+	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
+
+		z_sched_usage_ready(thread);
+		queue_thread(thread);
+	}
+}
+
 int z_unpend_all(_wait_q_t *wait_q)
 {
-	int need_sched = 0;
+	struct z_sched_batch batch;
 	struct k_thread *thread;
 
-	while ((thread = z_waitq_head(wait_q)) != NULL) {
-		z_unpend_thread(thread);
-		z_ready_thread(thread);
-		need_sched = 1;
+	z_sched_batch_begin(&batch);
+
+	while ((thread = _priq_wait_best(&wait_q->waitq)) != NULL) {
+		batch_ready_thread(thread);
+		batch.woken++;
 	}
 
-	return need_sched;
+	return (z_sched_batch_end(&batch) != 0) ? 1 : 0;
 }
 
 void init_ready_q(struct _ready_q *rq)
@@ -1290,7 +1338,7 @@ void init_ready_q(struct _ready_q *rq)
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+	for (int i = 0; i < ARRAY_SIZE(rq->runq.queues); i++) {
 		sys_dlist_init(&rq->runq.queues[i]);
 	}
 #else
@@ -1300,7 +1348,7 @@ void init_ready_q(struct _ready_q *rq)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
@@ -1916,6 +1964,45 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	return ret;
 }
 
+void z_sched_batch_begin(struct z_sched_batch *batch)
+{
+	batch->key = k_spin_lock(&sched_spinlock);
+	batch->woken = 0;
+}
+
+void z_sched_batch_wake(struct z_sched_batch *batch, struct k_thread *thread,
+			int swap_retval, void *swap_data)
+{
+	z_thread_return_value_set_with_data(thread, swap_retval, swap_data);
+	batch_ready_thread(thread);
+	batch->woken++;
+}
+
+int z_sched_batch_end(struct z_sched_batch *batch)
+{
+	if (batch->woken != 0) {
+		update_cache(0);
+		flag_ipi();
+	}
+	k_spin_unlock(&sched_spinlock, batch->key);
+
+	return batch->woken;
+}
+
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data)
+{
+	struct z_sched_batch batch;
+	struct k_thread *thread;
+
+	z_sched_batch_begin(&batch);
+
+	while ((thread = _priq_wait_best(&wait_q->waitq)) != NULL) {
+		z_sched_batch_wake(&batch, thread, swap_retval, swap_data);
+	}
+
+	return z_sched_batch_end(&batch);
+}
+
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
 {
@@ -38,6 +38,12 @@
  */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_SYNC_CONTENTION_STATS
+#define CONTENTION_INC(sem, field) ((sem)->contention.field++)
+#else
+#define CONTENTION_INC(sem, field) do { } while (false)
+#endif
+
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		      unsigned int limit)
 {
@@ -52,6 +58,9 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 
 	sem->count = initial_count;
 	sem->limit = limit;
+#ifdef CONFIG_SYNC_CONTENTION_STATS
+	sem->contention = (struct k_sync_contention_stats){ 0 };
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, init, sem, 0);
 
@@ -121,6 +130,54 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 #include <syscalls/k_sem_give_mrsh.c>
 #endif
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+/* A semaphore has no owner to watch, so spinning is worth it only
+ * while some other CPU runs a thread that might give it.
+ */
+static bool other_cpus_busy(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct _cpu *self = arch_curr_cpu();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *curr = _kernel.cpus[i].current;
+
+		if ((&_kernel.cpus[i] != self) && (curr != NULL) &&
+		    !z_is_idle_thread_object(curr)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Called with the lock held on an empty semaphore.  Drops the lock
+ * and busy-waits for a give, for at most CONFIG_ADAPTIVE_SPIN_MAX_US.
+ * Returns with the lock held again, true if the count is now non-zero.
+ */
+static bool sem_spin(struct k_sem *sem, k_spinlock_key_t *key)
+{
+	uint32_t budget = z_adaptive_spin_cycles();
+	uint32_t start;
+
+	if ((z_waitq_head(&sem->wait_q) != NULL) || !other_cpus_busy()) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	start = k_cycle_get_32();
+	while ((sem->count == 0U) &&
+	       ((k_cycle_get_32() - start) < budget)) {
+		compiler_barrier();
+		arch_nop();
+	}
+
+	*key = k_spin_lock(&lock);
+
+	return sem->count > 0U;
+}
+#endif /* CONFIG_ADAPTIVE_SPIN */
+
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
 	int ret = 0;
@@ -145,8 +202,22 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 		goto out;
 	}
 
+	CONTENTION_INC(sem, contended);
+
+#ifdef CONFIG_ADAPTIVE_SPIN
+	if (sem_spin(sem, &key)) {
+		CONTENTION_INC(sem, spin_acquired);
+		sem->count--;
+		k_spin_unlock(&lock, key);
+		ret = 0;
+		goto out;
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
+	CONTENTION_INC(sem, pended);
+
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
 
 out:
@@ -155,6 +226,24 @@ out:
 	return ret;
 }
 
+#ifdef CONFIG_SYNC_CONTENTION_STATS
+int k_sem_contention_stats_get(struct k_sem *sem,
+			       struct k_sync_contention_stats *stats)
+{
+	if ((sem == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = sem->contention;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SYNC_CONTENTION_STATS */
+
 void z_impl_k_sem_reset(struct k_sem *sem)
 {
 	struct k_thread *thread;
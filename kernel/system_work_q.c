@@ -19,6 +19,15 @@ static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 
 struct k_work_q k_sys_work_q;
 
+#if defined(CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE) && (CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE > 0)
+#define SYS_WORK_Q_POOL_SIZE CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE
+
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_pool_stacks, SYS_WORK_Q_POOL_SIZE,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+static struct k_thread sys_work_q_pool_threads[SYS_WORK_Q_POOL_SIZE];
+static k_thread_stack_t *sys_work_q_pool_stack_ptrs[SYS_WORK_Q_POOL_SIZE];
+#endif
+
 static int k_sys_work_q_init(void)
 {
 	struct k_work_queue_config cfg = {
@@ -26,6 +35,16 @@ static int k_sys_work_q_init(void)
 		.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
 	};
 
+#ifdef SYS_WORK_Q_POOL_SIZE
+	for (int i = 0; i < SYS_WORK_Q_POOL_SIZE; i++) {
+		sys_work_q_pool_stack_ptrs[i] = sys_work_q_pool_stacks[i];
+	}
+
+	cfg.pool_size = SYS_WORK_Q_POOL_SIZE;
+	cfg.pool_threads = sys_work_q_pool_threads;
+	cfg.pool_stacks = sys_work_q_pool_stack_ptrs;
+#endif
+
 	k_work_queue_start(&k_sys_work_q,
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
@@ -545,6 +545,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	z_object_init(stack);
 	new_thread->stack_obj = stack;
 	new_thread->syscall_frame = NULL;
+#ifdef CONFIG_SYSCALL_VALIDATION_CACHE
+	z_syscall_cache_init(new_thread);
+#endif
 
 	/* Any given thread has access to itself */
 	k_object_access_grant(new_thread, new_thread);
@@ -580,9 +583,6 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	/* Initialize custom data field (value is opaque to kernel) */
 	new_thread->custom_data = NULL;
 #endif
-#ifdef CONFIG_EVENTS
-	new_thread->no_wake_on_timeout = false;
-#endif
 #ifdef CONFIG_THREAD_MONITOR
 	new_thread->entry.pEntry = entry;
 	new_thread->entry.parameter1 = p1;
@@ -807,6 +807,7 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 
 #ifdef CONFIG_SMP
 	thread_base->is_idle = 0;
+	thread_base->cpu = 0U;
 #endif
 
 #ifdef CONFIG_TIMESLICE_PER_THREAD
@@ -1118,6 +1119,12 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+		for (int b = 0; b < CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS; b++) {
+			stats->histogram.latency[b] += tmp_stats.histogram.latency[b];
+			stats->histogram.slice[b]   += tmp_stats.histogram.slice[b];
+		}
+#endif
 	}
 #endif
 
@@ -11,11 +11,10 @@
 #include <zephyr/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 static struct k_spinlock timeout_lock;
 
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
@@ -36,6 +35,370 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+#define WHEEL_BITS   CONFIG_TIMEOUT_WHEEL_BITS
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEEL_SPAN   BIT64(WHEEL_BITS * WHEEL_LEVELS)
+
+/* Level N of the wheel hashes timeouts expiring between
+ * 2^(N * WHEEL_BITS) and 2^((N + 1) * WHEEL_BITS) ticks from
+ * curr_tick by their absolute expiry, and is cascaded into the lower
+ * levels when curr_tick reaches the start of a slot.  The bitmaps
+ * track which slot lists are initialized and possibly non-empty; bits
+ * are only cleared lazily by wheel_next_slot() so that cancelling a
+ * timeout never needs to know which slot it was hashed into.
+ */
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint64_t wheel_map[WHEEL_LEVELS];
+
+static inline int64_t wheel_delta(const struct _timeout *t)
+{
+#ifdef CONFIG_TIMEOUT_64BIT
+	return t->dticks - (int64_t)curr_tick;
+#else
+	return (int32_t)((uint32_t)t->dticks - (uint32_t)curr_tick);
+#endif
+}
+
+/* Hashes @to into the wheel, returns the tick at which its slot is due */
+static uint64_t wheel_insert(struct _timeout *to)
+{
+	int64_t delta = CLAMP(wheel_delta(to), 0, (int64_t)WHEEL_SPAN - 1);
+	uint64_t when = curr_tick + delta;
+	unsigned int level = 0U;
+	unsigned int shift, slot;
+
+	if (delta >= (int64_t)WHEEL_SLOTS) {
+		level = (31 - u32_count_leading_zeros((uint32_t)delta)) / WHEEL_BITS;
+	}
+
+	shift = level * WHEEL_BITS;
+	slot = (when >> shift) & WHEEL_MASK;
+
+	if ((wheel_map[level] & BIT64(slot)) == 0U) {
+		sys_dlist_init(&wheel[level][slot]);
+		wheel_map[level] |= BIT64(slot);
+	}
+	sys_dlist_append(&wheel[level][slot], &to->node);
+
+	return (when >> shift) << shift;
+}
+
+/* Distance from slot @from to the next non-empty slot of @level, or -1 */
+static int wheel_next_slot(unsigned int level, unsigned int from)
+{
+	for (;;) {
+		uint64_t map = wheel_map[level];
+		unsigned int slot;
+		int d;
+
+		if (from != 0U) {
+			map = ((map >> from) | (map << (WHEEL_SLOTS - from))) &
+			      GENMASK64(WHEEL_SLOTS - 1, 0);
+		}
+
+		if (map == 0U) {
+			return -1;
+		}
+
+		d = u64_count_trailing_zeros(map);
+		slot = (from + d) & WHEEL_MASK;
+
+		if (!sys_dlist_is_empty(&wheel[level][slot])) {
+			return d;
+		}
+		wheel_map[level] &= ~BIT64(slot);
+	}
+}
+
+/* Earliest tick at which a slot of the wheel is due, in at most
+ * WHEEL_LEVELS bitmap scans
+ */
+static bool wheel_next_event(uint64_t *when)
+{
+	uint64_t next = UINT64_MAX;
+
+	for (unsigned int level = 0; level < WHEEL_LEVELS; level++) {
+		unsigned int shift = level * WHEEL_BITS;
+		uint64_t period = (curr_tick >> shift) + 1U;
+		int d = wheel_next_slot(level, period & WHEEL_MASK);
+
+		if (d >= 0) {
+			next = MIN(next, (period + d) << shift);
+		}
+	}
+
+	*when = next;
+	return next != UINT64_MAX;
+}
+
+/* Re-hashes the slots of the upper levels starting at curr_tick,
+ * highest level first, so that everything expiring on curr_tick ends
+ * up in its level 0 slot.  An entry can never be re-hashed into the
+ * slot it is being moved out of.
+ */
+static void wheel_cascade(void)
+{
+	for (unsigned int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		unsigned int shift = level * WHEEL_BITS;
+		unsigned int slot = (curr_tick >> shift) & WHEEL_MASK;
+		sys_dnode_t *node;
+
+		if (((curr_tick & BIT64_MASK(shift)) != 0U) ||
+		    ((wheel_map[level] & BIT64(slot)) == 0U)) {
+			continue;
+		}
+
+		while ((node = sys_dlist_get(&wheel[level][slot])) != NULL) {
+			(void)wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+		}
+	}
+}
+
+static struct _timeout *wheel_first_expired(void)
+{
+	unsigned int slot = curr_tick & WHEEL_MASK;
+	sys_dnode_t *t;
+
+	if ((wheel_map[0] & BIT64(slot)) == 0U) {
+		return NULL;
+	}
+
+	t = sys_dlist_peek_head(&wheel[0][slot]);
+
+	return t == NULL ? NULL : CONTAINER_OF(t, struct _timeout, node);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	sys_dlist_remove(&t->node);
+}
+
+/* Returns true if @to is now the first timeout to expire */
+static bool insert_timeout(struct _timeout *to)
+{
+	uint64_t prev, when;
+	bool had_next = wheel_next_event(&prev);
+
+	to->dticks += curr_tick;
+	when = wheel_insert(to);
+
+	return !had_next || (when < prev);
+}
+
+static bool next_dticks(int64_t *dticks)
+{
+	uint64_t when;
+
+	if (!wheel_next_event(&when)) {
+		return false;
+	}
+
+	*dticks = when - curr_tick;
+	return true;
+}
+
+#ifdef CONFIG_ZTEST
+/* Moves every pending timeout along with curr_tick */
+static void wheel_rebase(uint64_t tick)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+
+	for (unsigned int level = 0; level < WHEEL_LEVELS; level++) {
+		for (unsigned int slot = 0; slot < WHEEL_SLOTS; slot++) {
+			if ((wheel_map[level] & BIT64(slot)) == 0U) {
+				continue;
+			}
+			while ((node = sys_dlist_get(&wheel[level][slot])) != NULL) {
+				sys_dlist_append(&pending, node);
+			}
+		}
+		wheel_map[level] = 0U;
+	}
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+		t->dticks += tick - curr_tick;
+	}
+
+	curr_tick = tick;
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		(void)wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+#endif /* CONFIG_ZTEST */
+
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+
+/* Each CPU keeps the timeouts armed on it sorted by absolute expiry
+ * tick under its own lock.  timeout_lock is never taken while holding
+ * a queue lock, while sys_clock_announce() takes queue locks with
+ * timeout_lock held.
+ */
+struct timeout_queue {
+	struct k_spinlock lock;
+	sys_dlist_t list;
+};
+
+#define TIMEOUT_QUEUE_INIT(i, _) \
+	{ .list = SYS_DLIST_STATIC_INIT(&timeout_queues[i].list) }
+
+static struct timeout_queue timeout_queues[CONFIG_MP_MAX_NUM_CPUS] = {
+	LISTIFY(CONFIG_MP_MAX_NUM_CPUS, TIMEOUT_QUEUE_INIT, (,))
+};
+
+static struct _timeout *first(struct timeout_queue *q)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(&q->list);
+
+	return t == NULL ? NULL : CONTAINER_OF(t, struct _timeout, node);
+}
+
+static struct _timeout *next(struct timeout_queue *q, struct _timeout *t)
+{
+	sys_dnode_t *n = sys_dlist_peek_next(&q->list, &t->node);
+
+	return n == NULL ? NULL : CONTAINER_OF(n, struct _timeout, node);
+}
+
+/* must be locked (timeout_lock) */
+static uint8_t timeout_cpu(struct _timeout *to)
+{
+	uint8_t cpu = arch_curr_cpu()->id;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (to->fn == z_thread_timeout) {
+		struct k_thread *thread = CONTAINER_OF(to, struct k_thread,
+						       base.timeout);
+		uint8_t mask = thread->base.cpu_mask;
+
+		if (IS_POWER_OF_TWO(mask)) {
+			cpu = u32_count_trailing_zeros(mask);
+		}
+	}
+#endif
+
+	return cpu;
+}
+
+/* Returns true if @to is now the first timeout to expire on its CPU */
+static bool insert_timeout(struct _timeout *to)
+{
+	struct timeout_queue *q = &timeout_queues[to->cpu];
+	bool ret = false;
+
+	LOCKED(&q->lock) {
+		struct _timeout *t;
+
+		for (t = first(q); t != NULL; t = next(q, t)) {
+			if (t->dticks > to->dticks) {
+				sys_dlist_insert(&t->node, &to->node);
+				break;
+			}
+		}
+
+		if (t == NULL) {
+			sys_dlist_append(&q->list, &to->node);
+		}
+
+		ret = (to == first(q));
+	}
+
+	return ret;
+}
+
+/* must be locked (timeout_lock) */
+static bool next_dticks(int64_t *dticks)
+{
+	bool found = false;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct timeout_queue *q = &timeout_queues[i];
+
+		LOCKED(&q->lock) {
+			struct _timeout *t = first(q);
+
+			if ((t != NULL) &&
+			    (!found || ((t->dticks - (int64_t)curr_tick) < *dticks))) {
+				*dticks = t->dticks - (int64_t)curr_tick;
+				found = true;
+			}
+		}
+	}
+
+	return found;
+}
+
+/* must be locked (timeout_lock), removes and returns the earliest
+ * timeout expiring no later than @end.  A timeout armed concurrently
+ * on another CPU may only be seen on the next call.
+ */
+static struct _timeout *pop_expired(uint64_t end)
+{
+	struct timeout_queue *best = NULL;
+	struct _timeout *ret = NULL;
+	int64_t best_dticks = (int64_t)end;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct timeout_queue *q = &timeout_queues[i];
+
+		LOCKED(&q->lock) {
+			struct _timeout *t = first(q);
+
+			if ((t != NULL) && (t->dticks <= best_dticks)) {
+				best_dticks = t->dticks;
+				best = q;
+			}
+		}
+	}
+
+	if (best != NULL) {
+		LOCKED(&best->lock) {
+			struct _timeout *t = first(best);
+
+			if ((t != NULL) && (t->dticks <= (int64_t)end)) {
+				sys_dlist_remove(&t->node);
+				ret = t;
+			}
+		}
+	}
+
+	return ret;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	sys_dlist_remove(&t->node);
+}
+
+#ifdef CONFIG_ZTEST
+/* Moves every pending timeout along with curr_tick */
+static void queues_rebase(uint64_t tick)
+{
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct timeout_queue *q = &timeout_queues[i];
+
+		LOCKED(&q->lock) {
+			for (struct _timeout *t = first(q); t != NULL; t = next(q, t)) {
+				t->dticks += tick - curr_tick;
+			}
+		}
+	}
+}
+#endif /* CONFIG_ZTEST */
+
+#else /* CONFIG_TIMEOUT_QUEUE_DLIST */
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -59,6 +422,41 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* Returns true if @to is now the first timeout to expire */
+static bool insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+
+	return to == first();
+}
+
+static bool next_dticks(int64_t *dticks)
+{
+	struct _timeout *to = first();
+
+	if (to == NULL) {
+		return false;
+	}
+
+	*dticks = to->dticks;
+	return true;
+}
+
+#endif /* CONFIG_TIMEOUT_QUEUE_* */
+
 static int32_t elapsed(void)
 {
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
@@ -66,20 +464,33 @@ static int32_t elapsed(void)
 
 static int32_t next_timeout(void)
 {
-	struct _timeout *to = first();
+	int64_t dticks;
 	int32_t ticks_elapsed = elapsed();
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if (!next_dticks(&dticks) ||
+	    ((int64_t)(dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
 }
 
+/* must be locked */
+static k_ticks_t timeout_dticks(k_timeout_t timeout)
+{
+	if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
+	    Z_TICK_ABS(timeout.ticks) >= 0) {
+		k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+
+		return MAX(1, ticks);
+	}
+
+	return timeout.ticks + 1 + elapsed();
+}
+
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout)
 {
@@ -94,42 +505,37 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
 	LOCKED(&timeout_lock) {
-		struct _timeout *t;
-
-		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
-		    Z_TICK_ABS(timeout.ticks) >= 0) {
-			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
-
-			to->dticks = MAX(1, ticks);
-		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
-		}
-
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
+		to->dticks = curr_tick + timeout_dticks(timeout);
+		to->cpu = timeout_cpu(to);
+	}
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
+	if (insert_timeout(to)) {
+		LOCKED(&timeout_lock) {
+			sys_clock_set_timeout(next_timeout(), false);
 		}
+	}
+#else
+	LOCKED(&timeout_lock) {
+		to->dticks = timeout_dticks(timeout);
 
-		if (to == first()) {
+		if (insert_timeout(to)) {
 			sys_clock_set_timeout(next_timeout(), false);
 		}
 	}
+#endif
 }
 
 int z_abort_timeout(struct _timeout *to)
 {
 	int ret = -EINVAL;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+	LOCKED(&timeout_queues[to->cpu].lock) {
+#else
 	LOCKED(&timeout_lock) {
+#endif
 		if (sys_dnode_is_linked(&to->node)) {
 			remove_timeout(to);
 			ret = 0;
@@ -148,12 +554,18 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 		return 0;
 	}
 
+#if defined(CONFIG_TIMEOUT_QUEUE_WHEEL)
+	ticks = wheel_delta(timeout);
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+	ticks = timeout->dticks - curr_tick;
+#else
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
 		ticks += t->dticks;
 		if (timeout == t) {
 			break;
 		}
 	}
+#endif
 
 	return ticks - elapsed();
 }
@@ -208,6 +620,41 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	uint64_t when;
+
+	while (wheel_next_event(&when) &&
+	       ((when - curr_tick) <= (uint64_t)announce_remaining)) {
+		int dt = when - curr_tick;
+		struct _timeout *t;
+
+		curr_tick = when;
+		wheel_cascade();
+
+		while ((t = wheel_first_expired()) != NULL) {
+			remove_timeout(t);
+
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+
+		announce_remaining -= dt;
+	}
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+	struct _timeout *t;
+
+	while ((t = pop_expired(curr_tick + announce_remaining)) != NULL) {
+		int dt = MAX(0, t->dticks - (int64_t)curr_tick);
+
+		curr_tick += dt;
+
+		k_spin_unlock(&timeout_lock, key);
+		t->fn(t);
+		key = k_spin_lock(&timeout_lock);
+		announce_remaining -= dt;
+	}
+#else
 	struct _timeout *t = first();
 
 	for (t = first();
@@ -228,6 +675,7 @@ void sys_clock_announce(int32_t ticks)
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -340,6 +788,11 @@ uint64_t sys_clock_timeout_end_calc(k_timeout_t timeout)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#if defined(CONFIG_TIMEOUT_QUEUE_WHEEL)
+	wheel_rebase(tick);
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+	queues_rebase(tick);
+#endif
 	curr_tick = tick;
 }
 
@@ -10,6 +10,8 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/syscall_handler.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -32,6 +34,67 @@ static uint32_t usage_now(void)
 	return (now == 0) ? 1 : now;
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+#define HIST_BUCKETS CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS
+
+static void hist_add(uint32_t *buckets, uint32_t cycles)
+{
+	unsigned int b = (cycles == 0U) ? 0U :
+			 31U - u32_count_leading_zeros(cycles);
+
+	buckets[MIN(b, HIST_BUCKETS - 1U)]++;
+}
+
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	thread->base.usage.stamp = usage_now();
+}
+
+/* Record the wakeup latency of @a thread, being switched in at @a now */
+static void sched_hist_start(struct _cpu *cpu, struct k_thread *thread,
+			     uint32_t now)
+{
+	uint32_t ready = thread->base.usage.stamp;
+
+	cpu->usage.stamp = now;
+
+	if (ready == 0U) {
+		/* Preempted rather than woken, or already counted */
+		return;
+	}
+	thread->base.usage.stamp = 0U;
+
+	if (thread->base.usage.track_usage) {
+		hist_add(thread->base.usage.histogram.latency, now - ready);
+	}
+	if (cpu->usage.track_usage && !z_is_idle_thread_object(thread)) {
+		hist_add(cpu->usage.histogram.latency, now - ready);
+	}
+}
+
+/* Record the length of the slice of the current thread, ending at @a now */
+static void sched_hist_stop(struct _cpu *cpu, uint32_t now)
+{
+	struct k_thread *thread = cpu->current;
+	uint32_t cycles = now - cpu->usage.stamp;
+
+	if (cpu->usage.stamp == 0U) {
+		return;
+	}
+	cpu->usage.stamp = 0U;
+
+	if (thread->base.usage.track_usage) {
+		hist_add(thread->base.usage.histogram.slice, cycles);
+	}
+	if (cpu->usage.track_usage && !z_is_idle_thread_object(thread)) {
+		hist_add(cpu->usage.histogram.slice, cycles);
+	}
+}
+#else
+#define sched_hist_start(cpu, thread, now)   do { } while (0)
+#define sched_hist_stop(cpu, now)            do { } while (0)
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 {
@@ -80,6 +143,8 @@ void z_sched_usage_start(struct k_thread *thread)
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
 
+	sched_hist_start(_current_cpu, thread, _current_cpu->usage0);
+
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
 		thread->base.usage.current = 0;
@@ -105,13 +170,15 @@ void z_sched_usage_stop(void)
 	uint32_t u0 = cpu->usage0;
 
 	if (u0 != 0) {
-		uint32_t cycles = usage_now() - u0;
+		uint32_t now = usage_now();
+		uint32_t cycles = now - u0;
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
 		}
 
 		sched_cpu_update_usage(cpu, cycles);
+		sched_hist_stop(cpu, now);
 	}
 
 	cpu->usage0 = 0;
@@ -164,6 +231,10 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	stats->histogram = _kernel.cpus[cpu_id].usage.histogram;
+#endif
+
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
 	k_spin_unlock(&usage_lock, key);
@@ -219,6 +290,9 @@ void z_sched_thread_usage(struct k_thread *thread,
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	stats->histogram = thread->base.usage.histogram;
 #endif
 	stats->execution_cycles = thread->base.usage.total;
 
@@ -343,3 +417,73 @@ void k_sys_runtime_stats_disable(void)
 	k_spin_unlock(&usage_lock, key);
 }
 #endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+int z_impl_k_thread_runtime_histogram_get(k_tid_t thread,
+					  struct k_cycle_histogram *hist)
+{
+	k_spinlock_key_t key;
+
+	CHECKIF((thread == NULL) || (hist == NULL)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&usage_lock);
+	*hist = thread->base.usage.histogram;
+	k_spin_unlock(&usage_lock, key);
+
+	return 0;
+}
+
+int z_impl_k_cpu_runtime_histogram_get(int cpu_id,
+				       struct k_cycle_histogram *hist)
+{
+	k_spinlock_key_t key;
+
+	CHECKIF((cpu_id < 0) || ((unsigned int)cpu_id >= arch_num_cpus()) || (hist == NULL)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&usage_lock);
+	*hist = _kernel.cpus[cpu_id].usage.histogram;
+	k_spin_unlock(&usage_lock, key);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_runtime_histogram_get(k_tid_t thread,
+							struct k_cycle_histogram *hist)
+{
+	struct k_cycle_histogram tmp;
+	int ret;
+
+	Z_OOPS(Z_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+
+	ret = z_impl_k_thread_runtime_histogram_get(thread, &tmp);
+	if (ret == 0) {
+		Z_OOPS(z_user_to_copy(hist, &tmp, sizeof(tmp)));
+	}
+
+	return ret;
+}
+#include <syscalls/k_thread_runtime_histogram_get_mrsh.c>
+
+static inline int z_vrfy_k_cpu_runtime_histogram_get(int cpu_id,
+						     struct k_cycle_histogram *hist)
+{
+	struct k_cycle_histogram tmp;
+	int ret;
+
+	Z_OOPS(Z_SYSCALL_VERIFY((cpu_id >= 0) && ((unsigned int)cpu_id < arch_num_cpus())));
+
+	ret = z_impl_k_cpu_runtime_histogram_get(cpu_id, &tmp);
+	if (ret == 0) {
+		Z_OOPS(z_user_to_copy(hist, &tmp, sizeof(tmp)));
+	}
+
+	return ret;
+}
+#include <syscalls/k_cpu_runtime_histogram_get_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
@@ -8,7 +8,7 @@
 #include <zephyr/kernel.h>
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
-#include <zephyr/sys/rb.h>
+#include <zephyr/sys/hash_map.h>
 #include <zephyr/kernel_structs.h>
 #include <zephyr/sys/sys_io.h>
 #include <ksched.h>
@@ -47,7 +47,7 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
  * not.
  */
 #ifdef CONFIG_DYNAMIC_OBJECTS
-static struct k_spinlock lists_lock;       /* kobj rbtree/dlist */
+static struct k_spinlock lists_lock;       /* kobj hash index */
 static struct k_spinlock objfree_lock;     /* k_object_free */
 #endif
 static struct k_spinlock obj_lock;         /* kobj struct data */
@@ -135,8 +135,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 
 struct dyn_obj {
 	struct z_object kobj;
-	sys_dnode_t dobj_list;
-	struct rbnode node; /* must be immediately before data member */
+	sys_snode_t unref_node; /* pending disposal, see obj_unref_list */
 
 	/* The object itself */
 	uint8_t data[] __aligned(DYN_OBJ_DATA_ALIGN_K_THREAD);
@@ -146,26 +145,26 @@ extern struct z_object *z_object_gperf_find(const void *obj);
 extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 					     void *context);
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b);
+static void *obj_index_alloc(void *ptr, size_t size);
 
 /*
- * Red/black tree of allocated kernel objects, for reasonably fast lookups
- * based on object pointer values.
- */
-static struct rbtree obj_rb_tree = {
-	.lessthan_fn = node_lessthan
-};
-
-/*
- * Linked list of allocated kernel objects, for iteration over all allocated
- * objects (and potentially deleting them during iteration).
+ * Hash index of allocated kernel objects, keyed by object pointer value
+ * and holding the containing struct dyn_obj. Used both for lookups during
+ * syscall validation and for iteration over all allocated objects.
+ *
+ * Object pointers share their low bits, so hash them with Murmur3 rather
+ * than whatever the system default is.
  */
-static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC_ADVANCED(obj_index, sys_hash32_murmur3,
+					 obj_index_alloc,
+					 SYS_HASHMAP_CONFIG(SIZE_MAX, SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
 
 /*
- * TODO: Write some hash table code that will replace both obj_rb_tree
- * and obj_list.
+ * Objects whose last reference was dropped while obj_index was being
+ * walked. The index cannot be modified under an iterator, so these are
+ * unlinked and freed once the walk completes.
  */
+static sys_slist_t obj_unref_list = SYS_SLIST_STATIC_INIT(&obj_unref_list);
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -201,40 +200,59 @@ static size_t obj_align_get(enum k_objects otype)
 	return ret;
 }
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b)
-{
-	return a < b;
-}
+/*
+ * The index is shared by all threads, so it comes from its own heap rather
+ * than from the resource pool of whichever thread makes it grow.
+ */
+K_HEAP_DEFINE(obj_index_heap, CONFIG_DYNAMIC_OBJECTS_INDEX_HEAP_SIZE);
 
-static inline struct dyn_obj *node_to_dyn_obj(struct rbnode *node)
+/*
+ * All hashmap backends rebuild the whole table when resizing, so the
+ * previous contents need not be preserved. The old table is only released
+ * once the new one has been obtained, as a failed resize keeps using it.
+ */
+static void *obj_index_alloc(void *ptr, size_t size)
 {
-	return CONTAINER_OF(node, struct dyn_obj, node);
-}
+	void *ret = NULL;
 
-static inline struct rbnode *dyn_obj_to_node(void *obj)
-{
-	struct dyn_obj *dobj = CONTAINER_OF(obj, struct dyn_obj, data);
+	if (size != 0) {
+		ret = k_heap_alloc(&obj_index_heap, size, K_NO_WAIT);
+		if (ret == NULL) {
+			return NULL;
+		}
+	}
 
-	return &dobj->node;
+	if (ptr != NULL) {
+		k_heap_free(&obj_index_heap, ptr);
+	}
+
+	return ret;
 }
 
 static struct dyn_obj *dyn_object_find(void *obj)
 {
-	struct rbnode *node;
-	struct dyn_obj *ret;
+	uint64_t value;
+	struct dyn_obj *ret = NULL;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
-	node = dyn_obj_to_node(obj);
+	k_spinlock_key_t key = k_spin_lock(&lists_lock);
+
+	if (sys_hashmap_get(&obj_index, POINTER_TO_UINT(obj), &value)) {
+		ret = UINT_TO_POINTER((uintptr_t)value);
+	}
+	k_spin_unlock(&lists_lock, key);
+
+	return ret;
+}
+
+static struct dyn_obj *dyn_object_unlink(void *obj)
+{
+	uint64_t value;
+	struct dyn_obj *ret = NULL;
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
-	if (rb_contains(&obj_rb_tree, node)) {
-		ret = node_to_dyn_obj(node);
-	} else {
-		ret = NULL;
+
+	if (sys_hashmap_remove(&obj_index, POINTER_TO_UINT(obj), &value)) {
+		ret = UINT_TO_POINTER((uintptr_t)value);
 	}
 	k_spin_unlock(&lists_lock, key);
 
@@ -276,6 +294,7 @@ static bool thread_idx_alloc(uintptr_t *tidx)
 			/* Clear permission from all objects */
 			z_object_wordlist_foreach(clear_perms_cb,
 						   (void *)*tidx);
+			z_syscall_cache_invalidate();
 
 			return true;
 		}
@@ -300,6 +319,7 @@ static void thread_idx_free(uintptr_t tidx)
 {
 	/* To prevent leaked permission when index is recycled */
 	z_object_wordlist_foreach(clear_perms_cb, (void *)tidx);
+	z_syscall_cache_invalidate();
 
 	sys_bitfield_set_bit((mem_addr_t)_thread_idx_map, tidx);
 }
@@ -307,6 +327,7 @@ static void thread_idx_free(uintptr_t tidx)
 struct z_object *z_dynamic_object_aligned_create(size_t align, size_t size)
 {
 	struct dyn_obj *dyn;
+	int ret;
 
 	dyn = z_thread_aligned_alloc(align, sizeof(*dyn) + size);
 	if (dyn == NULL) {
@@ -321,10 +342,16 @@ struct z_object *z_dynamic_object_aligned_create(size_t align, size_t size)
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	rb_insert(&obj_rb_tree, &dyn->node);
-	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	ret = sys_hashmap_insert(&obj_index, POINTER_TO_UINT(&dyn->data),
+				 POINTER_TO_UINT(dyn), NULL);
 	k_spin_unlock(&lists_lock, key);
 
+	if (ret < 0) {
+		LOG_ERR("could not index kernel object, out of memory");
+		k_free(dyn);
+		return NULL;
+	}
+
 	return &dyn->kobj;
 }
 
@@ -396,10 +423,9 @@ void k_object_free(void *obj)
 
 	k_spinlock_key_t key = k_spin_lock(&objfree_lock);
 
-	dyn = dyn_object_find(obj);
+	dyn = dyn_object_unlink(obj);
 	if (dyn != NULL) {
-		rb_remove(&obj_rb_tree, &dyn->node);
-		sys_dlist_remove(&dyn->dobj_list);
+		z_syscall_cache_invalidate();
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -436,16 +462,35 @@ struct z_object *z_object_find(const void *obj)
 
 void z_object_wordlist_foreach(_wordlist_cb_func_t func, void *context)
 {
-	struct dyn_obj *obj, *next;
+	struct sys_hashmap_iterator it = { 0 };
+	struct dyn_obj *dyn;
+	sys_slist_t unref;
+	sys_snode_t *node;
 
 	z_object_gperf_wordlist_foreach(func, context);
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&obj_list, obj, next, dobj_list) {
-		func(&obj->kobj, context);
+	for (obj_index.api->iter(&obj_index, &it);
+	     sys_hashmap_iterator_has_next(&it);) {
+		it.next(&it);
+		dyn = UINT_TO_POINTER((uintptr_t)it.value);
+		func(&dyn->kobj, context);
+	}
+
+	/* Unlink whatever lost its last reference during the walk */
+	sys_slist_init(&unref);
+	while ((node = sys_slist_get(&obj_unref_list)) != NULL) {
+		dyn = CONTAINER_OF(node, struct dyn_obj, unref_node);
+		if (sys_hashmap_remove(&obj_index, POINTER_TO_UINT(&dyn->data), NULL)) {
+			sys_slist_append(&unref, node);
+		}
 	}
 	k_spin_unlock(&lists_lock, key);
+
+	while ((node = sys_slist_get(&unref)) != NULL) {
+		k_free(CONTAINER_OF(node, struct dyn_obj, unref_node));
+	}
 }
 #endif /* CONFIG_DYNAMIC_OBJECTS */
 
@@ -462,8 +507,13 @@ static unsigned int thread_index_get(struct k_thread *thread)
 	return ko->data.thread_id;
 }
 
-static void unref_check(struct z_object *ko, uintptr_t index)
+/* Returns true if the last reference to a dynamic object was dropped, in
+ * which case the object has been cleaned up and the caller is responsible
+ * for unlinking and freeing it.
+ */
+static bool unref_check(struct z_object *ko, uintptr_t index)
 {
+	bool unref = false;
 	k_spinlock_key_t key = k_spin_lock(&obj_lock);
 
 	sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
@@ -508,12 +558,14 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 		break;
 	}
 
-	rb_remove(&obj_rb_tree, &dyn->node);
-	sys_dlist_remove(&dyn->dobj_list);
-	k_free(dyn);
+	/* Only the first caller to see the object unreferenced disposes of it */
+	ko->flags &= ~K_OBJ_FLAG_ALLOC;
+	unref = true;
 out:
 #endif
 	k_spin_unlock(&obj_lock, key);
+
+	return unref;
 }
 
 static void wordlist_cb(struct z_object *ko, void *ctx_ptr)
@@ -554,15 +606,42 @@ void z_thread_perms_clear(struct z_object *ko, struct k_thread *thread)
 
 	if (index != -1) {
 		sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
-		unref_check(ko, index);
+		z_syscall_cache_invalidate();
+
+		if (unref_check(ko, index)) {
+#ifdef CONFIG_DYNAMIC_OBJECTS
+			void *vko = ko;
+			struct dyn_obj *dyn = CONTAINER_OF(vko, struct dyn_obj, kobj);
+
+			/* Someone else, e.g. k_object_free(), may have
+			 * unlinked it first and owns the free
+			 */
+			if (dyn_object_unlink(&dyn->data) != NULL) {
+				k_free(dyn);
+			}
+#endif
+		}
 	}
 }
 
+/* Called while walking the object index, with lists_lock held */
 static void clear_perms_cb(struct z_object *ko, void *ctx_ptr)
 {
 	uintptr_t id = (uintptr_t)ctx_ptr;
 
-	unref_check(ko, id);
+	/* Most objects were never granted to this thread index */
+	if (!sys_bitfield_test_bit((mem_addr_t)&ko->perms, id)) {
+		return;
+	}
+
+	if (unref_check(ko, id)) {
+#ifdef CONFIG_DYNAMIC_OBJECTS
+		void *vko = ko;
+		struct dyn_obj *dyn = CONTAINER_OF(vko, struct dyn_obj, kobj);
+
+		sys_slist_append(&obj_unref_list, &dyn->unref_node);
+#endif
+	}
 }
 
 void z_thread_perms_all_clear(struct k_thread *thread)
@@ -571,6 +650,7 @@ void z_thread_perms_all_clear(struct k_thread *thread)
 
 	if ((int)index != -1) {
 		z_object_wordlist_foreach(clear_perms_cb, (void *)index);
+		z_syscall_cache_invalidate();
 	}
 }
 
@@ -658,6 +738,26 @@ void k_object_access_all_grant(const void *object)
 	}
 }
 
+static int obj_init_check(struct z_object *ko, enum _obj_init_check init)
+{
+	/* Initialization state checks. _OBJ_INIT_ANY, we don't care */
+	if (likely(init == _OBJ_INIT_TRUE)) {
+		/* Object MUST be initialized */
+		if (unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+			return -EINVAL;
+		}
+	} else if (init == _OBJ_INIT_FALSE) { /* _OBJ_INIT_FALSE case */
+		/* Object MUST NOT be initialized */
+		if (unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) != 0U)) {
+			return -EADDRINUSE;
+		}
+	} else {
+		/* _OBJ_INIT_ANY */
+	}
+
+	return 0;
+}
+
 int z_object_validate(struct z_object *ko, enum k_objects otype,
 		       enum _obj_init_check init)
 {
@@ -673,23 +773,104 @@ int z_object_validate(struct z_object *ko, enum k_objects otype,
 		return -EPERM;
 	}
 
-	/* Initialization state checks. _OBJ_INIT_ANY, we don't care */
-	if (likely(init == _OBJ_INIT_TRUE)) {
-		/* Object MUST be initialized */
-		if (unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
-			return -EINVAL;
+	return obj_init_check(ko, init);
+}
+
+#ifdef CONFIG_SYSCALL_VALIDATION_CACHE
+/* Bumped whenever a thread may have lost access to something */
+static atomic_t syscall_cache_gen;
+
+void z_syscall_cache_init(struct k_thread *thread)
+{
+	(void)memset(&thread->syscall_cache, 0, sizeof(thread->syscall_cache));
+	thread->syscall_cache.generation = atomic_get(&syscall_cache_gen);
+}
+
+void z_syscall_cache_invalidate(void)
+{
+	(void)atomic_inc(&syscall_cache_gen);
+}
+
+/* Only the owning thread ever touches its cache, so no locking is needed.
+ * The generation is sampled before validating anything, so an entry added
+ * after a concurrent invalidation is discarded on the next system call.
+ */
+static struct _syscall_cache *syscall_cache_get(void)
+{
+	struct _syscall_cache *cache = &_current->syscall_cache;
+
+	if (unlikely(cache->generation != atomic_get(&syscall_cache_gen))) {
+		z_syscall_cache_init(_current);
+	}
+
+	return cache;
+}
+
+int z_object_validate_cached(const void *obj, enum k_objects otype,
+			     enum _obj_init_check init)
+{
+	struct _syscall_cache *cache = syscall_cache_get();
+	struct z_object *ko;
+	int ret;
+
+	for (int i = 0; i < CONFIG_SYSCALL_VALIDATION_CACHE_SIZE; i++) {
+		ko = cache->objs[i].ko;
+		if (ko == NULL || cache->objs[i].obj != obj) {
+			continue;
 		}
-	} else if (init == _OBJ_INIT_FALSE) { /* _OBJ_INIT_FALSE case */
-		/* Object MUST NOT be initialized */
-		if (unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) != 0U)) {
-			return -EADDRINUSE;
+
+		/* Lookup and permissions still hold, the object type and
+		 * initialization state are always checked again.
+		 */
+		if (likely((otype == K_OBJ_ANY || ko->type == otype) &&
+			   obj_init_check(ko, init) == 0)) {
+			return 0;
 		}
-	} else {
-		/* _OBJ_INIT_ANY */
+		break;
 	}
 
-	return 0;
+	ko = z_object_find(obj);
+	ret = z_obj_validation_check(ko, obj, otype, init);
+	if (ret == 0) {
+		cache->objs[cache->next_obj].obj = obj;
+		cache->objs[cache->next_obj].ko = ko;
+		cache->next_obj = (cache->next_obj + 1U) %
+				  CONFIG_SYSCALL_VALIDATION_CACHE_SIZE;
+	}
+
+	return ret;
+}
+
+int z_buffer_validate_cached(void *addr, size_t size, int write)
+{
+	struct _syscall_cache *cache = syscall_cache_get();
+	uintptr_t start = POINTER_TO_UINT(addr);
+	uintptr_t end;
+	int ret;
+
+	if (size == 0U || size_add_overflow(start, size, &end)) {
+		return arch_buffer_validate(addr, size, write);
+	}
+
+	for (int i = 0; i < CONFIG_SYSCALL_VALIDATION_CACHE_SIZE; i++) {
+		if (start >= cache->bufs[i].start && end <= cache->bufs[i].end &&
+		    (cache->bufs[i].write || write == 0)) {
+			return 0;
+		}
+	}
+
+	ret = arch_buffer_validate(addr, size, write);
+	if (ret == 0) {
+		cache->bufs[cache->next_buf].start = start;
+		cache->bufs[cache->next_buf].end = end;
+		cache->bufs[cache->next_buf].write = (write != 0);
+		cache->next_buf = (cache->next_buf + 1U) %
+				  CONFIG_SYSCALL_VALIDATION_CACHE_SIZE;
+	}
+
+	return ret;
 }
+#endif /* CONFIG_SYSCALL_VALIDATION_CACHE */
 
 void z_object_init(const void *obj)
 {
@@ -722,6 +903,7 @@ void z_object_recycle(const void *obj)
 
 	if (ko != NULL) {
 		(void)memset(ko->perms, 0, sizeof(ko->perms));
+		z_syscall_cache_invalidate();
 		z_thread_perms_set(ko, k_current_get());
 		ko->flags |= K_OBJ_FLAG_INITIALIZED;
 	}
@@ -57,10 +57,59 @@ static inline uint32_t flags_get(const uint32_t *flagp)
 	return *flagp;
 }
 
-/* Lock to protect the internal state of all work items, work queues,
- * and pending_cancels.
+/* Work items are protected by one of a small set of locks picked by
+ * hashing the item address, so that unrelated items (and the queues
+ * they are submitted to) do not contend on SMP.  Each lock also holds
+ * the cancellations, and the flushes on worker pool queues, pending on
+ * its items.  Work queue state is protected by the queue's own lock,
+ * which nests inside work item locks.
  */
-static struct k_spinlock lock;
+#define WORK_LOCK_COUNT (IS_ENABLED(CONFIG_SMP) ? 8 : 1)
+
+struct work_lock {
+	struct k_spinlock lock;
+
+	/* List of pending cancellations. */
+	sys_slist_t pending_cancels;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* List of pending flushes of items on worker pool queues. */
+	sys_slist_t pending_flushes;
+#endif
+};
+
+static struct work_lock work_locks[WORK_LOCK_COUNT];
+
+static inline struct work_lock *work_lock(const struct k_work *work)
+{
+	uintptr_t addr = (uintptr_t)work;
+
+	return &work_locks[((addr >> 4) ^ (addr >> 10)) % WORK_LOCK_COUNT];
+}
+
+static inline bool queue_is_pool(const struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	return queue->pool_size != 0U;
+#else
+	ARG_UNUSED(queue);
+
+	return false;
+#endif
+}
+
+/* Whether the current thread is one of those serving @p queue */
+static inline bool queue_thread_is_current(const struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	if ((_current >= queue->pool_threads) &&
+	    (_current < queue->pool_threads + queue->pool_size)) {
+		return true;
+	}
+#endif
+
+	return _current == &queue->thread;
+}
 
 /* Invoked by work thread */
 static void handle_flush(struct k_work *work)
@@ -77,9 +126,6 @@ static inline void init_flusher(struct z_work_flusher *flusher)
 	k_work_init(&flusher->work, handle_flush);
 }
 
-/* List of pending cancellations. */
-static sys_slist_t pending_cancels;
-
 /* Initialize a canceler record and add it to the list of pending
  * cancels.
  *
@@ -93,7 +139,7 @@ static inline void init_work_cancel(struct z_work_canceller *canceler,
 {
 	k_sem_init(&canceler->sem, 0, 1);
 	canceler->work = work;
-	sys_slist_append(&pending_cancels, &canceler->node);
+	sys_slist_append(&work_lock(work)->pending_cancels, &canceler->node);
 }
 
 /* Complete cancellation of a work item and unlock held lock.
@@ -108,6 +154,7 @@ static inline void init_work_cancel(struct z_work_canceller *canceler,
  */
 static void finalize_cancel_locked(struct k_work *work)
 {
+	sys_slist_t *pending_cancels = &work_lock(work)->pending_cancels;
 	struct z_work_canceller *wc, *tmp;
 	sys_snode_t *prev = NULL;
 
@@ -121,9 +168,9 @@ static void finalize_cancel_locked(struct k_work *work)
 	 * appear multiple times in the list if multiple threads
 	 * attempt to cancel it.
 	 */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&pending_cancels, wc, tmp, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(pending_cancels, wc, tmp, node) {
 		if (wc->work == work) {
-			sys_slist_remove(&pending_cancels, prev, &wc->node);
+			sys_slist_remove(pending_cancels, prev, &wc->node);
 			k_sem_give(&wc->sem);
 		} else {
 			prev = &wc->node;
@@ -149,17 +196,18 @@ static inline int work_busy_get_locked(const struct k_work *work)
 
 int k_work_busy_get(const struct k_work *work)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 	int ret = work_busy_get_locked(work);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	return ret;
 }
 
 /* Add a flusher work item to the queue.
  *
- * Invoked with work lock held.
+ * Invoked with work lock and queue lock held.
  *
  * Caller must notify queue of pending work.
  *
@@ -184,6 +232,10 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	}
 
 	init_flusher(flusher);
+
+	/* Nobody else knows the flusher, the queue lock is enough */
+	flag_set(&flusher->work.flags, K_WORK_QUEUED_BIT);
+
 	if (in_list) {
 		sys_slist_insert(&queue->pending, &work->node,
 				 &flusher->work.node);
@@ -192,6 +244,31 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	}
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* Account for one completion (or removal) of a work item queued on a
+ * worker pool queue, releasing flushers that no longer need to wait.
+ *
+ * Invoked with work lock held.
+ *
+ * @param work the work item that completed
+ */
+static void finalize_flush_locked(struct k_work *work)
+{
+	sys_slist_t *pending_flushes = &work_lock(work)->pending_flushes;
+	struct z_work_flusher *wf, *tmp;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(pending_flushes, wf, tmp, work.node) {
+		if ((wf->target == work) && (--wf->remaining == 0U)) {
+			sys_slist_remove(pending_flushes, prev, &wf->work.node);
+			k_sem_give(&wf->sem);
+		} else {
+			prev = &wf->work.node;
+		}
+	}
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Try to remove a work item from the given queue.
  *
  * Invoked with work lock held.
@@ -203,11 +280,22 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		/* Not found if deferred behind its own run on a pool */
 		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
+
+		k_spin_unlock(&queue->lock, key);
+
+#ifdef CONFIG_WORKQUEUE_POOL
+		finalize_flush_locked(work);
+#endif
 	}
 }
 
 /* Potentially notify a queue that it needs to look for pending work.
+ *
+ * Invoked with queue lock held.
  *
  * This may make the work queue thread ready, but as the lock is held it
  * will not be a reschedule point.  Callers should yield after the lock is
@@ -229,37 +317,40 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
-/* Submit an work item to a queue if queue state allows new work.
+/* Add a work item to a queue if queue state allows new work.
  *
- * Submission is rejected if no queue is provided, or if the queue is
- * draining and the work isn't being submitted from the queue's
- * thread (chained submission).
+ * Submission is rejected if the queue is draining and the work isn't
+ * being submitted from the queue's thread (chained submission).
  *
- * Invoked with work lock held.
- * Conditionally notifies queue.
+ * Invoked with work lock and queue lock held.  Does not notify the
+ * queue: the caller does so if this returns true through @p listed.
  *
- * @param queue the queue to which work should be submitted.  This may
- * be null, in which case the submission will fail.
+ * @param queue the queue to which work should be submitted.
  *
  * @param work to be submitted
  *
+ * @param running true if @p work is running on @p queue.  Worker pool
+ * queues then leave it to the thread running it to list it again once
+ * done, so that it never runs concurrently with itself.
+ *
+ * @param listed set to true if @p work was added to the pending list.
+ *
  * @retval 1 if successfully queued
- * @retval -EINVAL if no queue is provided
  * @retval -ENODEV if the queue is not started
  * @retval -EBUSY if the submission was rejected (draining, plugged)
  */
-static inline int queue_submit_locked(struct k_work_q *queue,
-				      struct k_work *work)
+static inline int queue_insert_locked(struct k_work_q *queue,
+				      struct k_work *work,
+				      bool running,
+				      bool *listed)
 {
-	if (queue == NULL) {
-		return -EINVAL;
-	}
-
 	int ret = -EBUSY;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = queue_thread_is_current(queue) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
+	*listed = false;
+
 	/* Test for acceptability, in priority order:
 	 *
 	 * * -ENODEV if the queue isn't running.
@@ -273,12 +364,52 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 		ret = -EBUSY;
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
+	} else if (running && queue_is_pool(queue)) {
+		ret = 1;
 	} else {
 		sys_slist_append(&queue->pending, &work->node);
+		*listed = true;
 		ret = 1;
+	}
+
+	return ret;
+}
+
+/* Submit an work item to a queue if queue state allows new work.
+ *
+ * Invoked with work lock held.  Takes and releases queue lock.
+ * Conditionally notifies queue.
+ *
+ * @param queue the queue to which work should be submitted.  This may
+ * be null, in which case the submission will fail.
+ *
+ * @param work to be submitted
+ *
+ * @param running true if @p work is running on @p queue.
+ *
+ * @retval 1 if successfully queued
+ * @retval -EINVAL if no queue is provided
+ * @retval -ENODEV if the queue is not started
+ * @retval -EBUSY if the submission was rejected (draining, plugged)
+ */
+static inline int queue_submit_locked(struct k_work_q *queue,
+				      struct k_work *work,
+				      bool running)
+{
+	if (queue == NULL) {
+		return -EINVAL;
+	}
+
+	bool listed;
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	int ret = queue_insert_locked(queue, work, running, &listed);
+
+	if (listed) {
 		(void)notify_queue_locked(queue);
 	}
 
+	k_spin_unlock(&queue->lock, key);
+
 	return ret;
 }
 
@@ -336,7 +467,7 @@ static int submit_to_queue_locked(struct k_work *work,
 			ret = 2;
 		}
 
-		int rc = queue_submit_locked(*queuep, work);
+		int rc = queue_submit_locked(*queuep, work, ret == 2);
 
 		if (rc < 0) {
 			ret = rc;
@@ -371,11 +502,12 @@ int z_work_submit_to_queue(struct k_work_q *queue,
 {
 	__ASSERT_NO_MSG(work != NULL);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 
 	int ret = submit_to_queue_locked(work, &queue);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	return ret;
 }
@@ -412,6 +544,180 @@ int k_work_submit(struct k_work *work)
 	return ret;
 }
 
+/* Work items handled per batch step, bounded by the width of the mask of
+ * items deferred to the single item path.
+ */
+#define BATCH_STEP 32U
+
+/* Saturation value of the coalesced submission count kept in the work
+ * flags above K_WORK_COALESCED_SHIFT.
+ */
+#define COALESCED_MAX (UINT32_MAX >> K_WORK_COALESCED_SHIFT)
+
+/* Count a submission of an already queued work item.
+ *
+ * Invoked with work lock held.
+ */
+static inline void work_coalesce_locked(struct k_work *work)
+{
+	if ((work->flags >> K_WORK_COALESCED_SHIFT) < COALESCED_MAX) {
+		work->flags += BIT(K_WORK_COALESCED_SHIFT);
+	}
+}
+
+/* Submit one item of a batch.
+ *
+ * Invoked with the work lock and the queue lock held.  Does not notify
+ * the queue.
+ *
+ * @param queue the queue the batch is submitted to.
+ *
+ * @param work to be submitted.
+ *
+ * @param flags the batch flags.
+ *
+ * @param listed set to true if @p work was added to the pending list.
+ *
+ * @retval as for submit_to_queue_locked(), plus
+ * @retval -EAGAIN if @p work is running on another queue and has to be
+ * submitted with the lock of that queue.
+ */
+static int batch_submit_locked(struct k_work_q *queue,
+			       struct k_work *work,
+			       uint32_t flags,
+			       bool *listed)
+{
+	bool running = flag_test(&work->flags, K_WORK_RUNNING_BIT);
+	int ret;
+
+	*listed = false;
+
+	if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
+		ret = -EBUSY;
+	} else if (flag_test(&work->flags, K_WORK_QUEUED_BIT)) {
+		if ((flags & K_WORK_BATCH_COALESCE) != 0U) {
+			work_coalesce_locked(work);
+		}
+		ret = 0;
+	} else if (running && (work->queue != queue)) {
+		ret = -EAGAIN;
+	} else {
+		ret = queue_insert_locked(queue, work, running, listed);
+		if (ret > 0) {
+			flag_set(&work->flags, K_WORK_QUEUED_BIT);
+			work->queue = queue;
+			ret = running ? 2 : 1;
+		}
+	}
+
+	return ret;
+}
+
+int k_work_submit_batch(struct k_work_q *queue,
+			struct k_work *const *works,
+			size_t count,
+			uint32_t flags)
+{
+	__ASSERT_NO_MSG((works != NULL) || (count == 0U));
+
+	if (queue == NULL) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t keys[WORK_LOCK_COUNT] = { 0 };
+	k_spinlock_key_t key;
+	bool notify = false;
+	int queued = 0;
+	int err = 0;
+
+	for (size_t base = 0; base < count; base += BATCH_STEP) {
+		size_t n = MIN(count - base, BATCH_STEP);
+		uint32_t locks = 0U;
+		uint32_t deferred = 0U;
+
+		/* Take every work lock the step needs in index order, so
+		 * that the queue lock is taken once for the whole step.
+		 */
+		for (size_t i = 0; i < n; i++) {
+			__ASSERT_NO_MSG(works[base + i] != NULL);
+			locks |= BIT(work_lock(works[base + i]) - work_locks);
+		}
+
+		for (size_t l = 0; l < WORK_LOCK_COUNT; l++) {
+			if ((locks & BIT(l)) != 0U) {
+				keys[l] = k_spin_lock(&work_locks[l].lock);
+			}
+		}
+
+		key = k_spin_lock(&queue->lock);
+
+		for (size_t i = 0; i < n; i++) {
+			bool listed;
+			int rc = batch_submit_locked(queue, works[base + i],
+						     flags, &listed);
+
+			if (rc == -EAGAIN) {
+				deferred |= BIT(i);
+			} else if (rc > 0) {
+				queued++;
+			} else if (rc < 0) {
+				err = rc;
+			}
+			notify |= listed;
+		}
+
+		k_spin_unlock(&queue->lock, key);
+
+		for (size_t l = WORK_LOCK_COUNT; l-- > 0;) {
+			if ((locks & BIT(l)) != 0U) {
+				k_spin_unlock(&work_locks[l].lock, keys[l]);
+			}
+		}
+
+		/* Items running on another queue go back to that queue,
+		 * which is notified on its own.
+		 */
+		while (deferred != 0U) {
+			size_t i = find_lsb_set(deferred) - 1U;
+			int rc = z_work_submit_to_queue(queue, works[base + i]);
+
+			if (rc > 0) {
+				queued++;
+			} else if (rc < 0) {
+				err = rc;
+			}
+			deferred &= deferred - 1U;
+		}
+	}
+
+	if (notify) {
+		key = k_spin_lock(&queue->lock);
+		(void)notify_queue_locked(queue);
+		k_spin_unlock(&queue->lock, key);
+	}
+
+	if (queued > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return ((queued > 0) || (err == 0)) ? queued : err;
+}
+
+uint32_t k_work_coalesced_take(struct k_work *work)
+{
+	__ASSERT_NO_MSG(work != NULL);
+
+	struct work_lock *wl = work_lock(work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
+	uint32_t ret = work->flags >> K_WORK_COALESCED_SHIFT;
+
+	work->flags &= ~(COALESCED_MAX << K_WORK_COALESCED_SHIFT);
+
+	k_spin_unlock(&wl->lock, key);
+
+	return ret;
+}
+
 /* Flush the work item if necessary.
  *
  * Flushing is necessary only if the work is either queued or running.
@@ -438,8 +744,32 @@ static bool work_flush_locked(struct k_work *work,
 
 		__ASSERT_NO_MSG(queue != NULL);
 
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (queue_is_pool(queue)) {
+			/* Another pool thread could process a flusher
+			 * queued behind the item while the item still
+			 * runs.  Count completions instead: the current
+			 * run, if any, and the queued one, if any.
+			 */
+			uint32_t flags = flags_get(&work->flags);
+
+			init_flusher(flusher);
+			flusher->target = work;
+			flusher->remaining =
+				(((flags & K_WORK_RUNNING) != 0U) ? 1U : 0U) +
+				(((flags & K_WORK_QUEUED) != 0U) ? 1U : 0U);
+			sys_slist_append(&work_lock(work)->pending_flushes,
+					 &flusher->work.node);
+			return need_flush;
+		}
+#endif
+
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
 		queue_flusher_locked(queue, work, flusher);
 		notify_queue_locked(queue);
+
+		k_spin_unlock(&queue->lock, key);
 	}
 
 	return need_flush;
@@ -459,11 +789,12 @@ bool k_work_flush(struct k_work *work,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, flush, work);
 
 	struct z_work_flusher *flusher = &sync->flusher;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 
 	bool need_flush = work_flush_locked(work, flusher);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	/* If necessary wait until the flusher item completes */
 	if (need_flush) {
@@ -547,10 +878,11 @@ int k_work_cancel(struct k_work *work)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, cancel, work);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 	int ret = cancel_async_locked(work);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, cancel, work, ret);
 
@@ -571,7 +903,8 @@ bool k_work_cancel_sync(struct k_work *work,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, cancel_sync, work, sync);
 
 	struct z_work_canceller *canceller = &sync->canceller;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 	bool pending = (work_busy_get_locked(work) != 0U);
 	bool need_wait = false;
 
@@ -580,7 +913,7 @@ bool k_work_cancel_sync(struct k_work *work,
 		need_wait = cancel_sync_locked(work, canceller);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	if (need_wait) {
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work, cancel_sync, work, sync);
@@ -592,6 +925,73 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+#define QUEUE_BUSY_INC(queue) ((queue)->busy++)
+#define QUEUE_BUSY_DEC(queue) (--(queue)->busy == 0U)
+#else
+#define QUEUE_BUSY_INC(queue) 0
+#define QUEUE_BUSY_DEC(queue) true
+#endif
+
+/* Take the first pending item of a queue and mark it running.
+ *
+ * Invoked with queue lock held by *keyp.  Work item locks rank above
+ * the queue lock, so this drops the queue lock to take the lock of
+ * the item at the head, then checks it is still there.  On success
+ * both locks are held on return; the work lock by *wkeyp, the queue
+ * lock (retaken) by *keyp.
+ *
+ * @return the work item, or NULL if the queue is empty.
+ */
+static struct k_work *queue_get_locked(struct k_work_q *queue,
+				       k_spinlock_key_t *keyp,
+				       k_spinlock_key_t *wkeyp)
+{
+	sys_snode_t *node;
+
+	while ((node = sys_slist_peek_head(&queue->pending)) != NULL) {
+		/* Static code analysis tool can raise a false-positive violation
+		 * in the line below that 'work' is checked for null after being
+		 * dereferenced.
+		 *
+		 * The work is figured out by CONTAINER_OF, as a container
+		 * of type struct k_work that contains the node.
+		 * The only way for it to be NULL is if node would be a member
+		 * of struct k_work object that has been placed at address NULL,
+		 * which should never happen, even line 'if (work != NULL)'
+		 * ensures that.
+		 * This means that if node is not NULL, then work will not be NULL.
+		 */
+		struct k_work *work = CONTAINER_OF(node, struct k_work, node);
+		struct work_lock *wl = work_lock(work);
+
+		k_spin_unlock(&queue->lock, *keyp);
+		*wkeyp = k_spin_lock(&wl->lock);
+		*keyp = k_spin_lock(&queue->lock);
+
+		if (sys_slist_peek_head(&queue->pending) == node) {
+			(void)sys_slist_get(&queue->pending);
+
+			/* Mark that there's some work active that's
+			 * not on the pending list.
+			 */
+			(void)QUEUE_BUSY_INC(queue);
+			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+			flag_set(&work->flags, K_WORK_RUNNING_BIT);
+			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
+
+			return work;
+		}
+
+		/* Cancelled or taken by another pool thread meanwhile */
+		k_spin_unlock(&queue->lock, *keyp);
+		k_spin_unlock(&wl->lock, *wkeyp);
+		*keyp = k_spin_lock(&queue->lock);
+	}
+
+	return NULL;
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -601,37 +1001,19 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
 
 	while (true) {
-		sys_snode_t *node;
-		struct k_work *work = NULL;
+		struct k_work *work;
+		struct work_lock *wl;
 		k_work_handler_t handler = NULL;
-		k_spinlock_key_t key = k_spin_lock(&lock);
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+		k_spinlock_key_t wkey;
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
-		if (node != NULL) {
-			/* Mark that there's some work active that's
-			 * not on the pending list.
-			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
-			work = CONTAINER_OF(node, struct k_work, node);
-			flag_set(&work->flags, K_WORK_RUNNING_BIT);
-			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
-
-			/* Static code analysis tool can raise a false-positive violation
-			 * in the line below that 'work' is checked for null after being
-			 * dereferenced.
-			 *
-			 * The work is figured out by CONTAINER_OF, as a container
-			 * of type struct k_work that contains the node.
-			 * The only way for it to be NULL is if node would be a member
-			 * of struct k_work object that has been placed at address NULL,
-			 * which should never happen, even line 'if (work != NULL)'
-			 * ensures that.
-			 * This means that if node is not NULL, then work will not be NULL.
-			 */
+		work = queue_get_locked(queue, &key, &wkey);
+		if (work != NULL) {
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -641,6 +1023,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * We don't touch K_WORK_QUEUE_PLUGGABLE, so getting
 			 * here doesn't mean that the queue will allow new
 			 * submissions.
+			 *
+			 * On a pool a thread still running an item gets
+			 * here once done.
 			 */
 			(void)z_sched_wake_all(&queue->drainq, 1, NULL);
 		} else {
@@ -657,12 +1042,14 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * work thread will be woken and we can check again.
 			 */
 
-			(void)z_sched_wait(&lock, key, &queue->notifyq,
+			(void)z_sched_wait(&queue->lock, key, &queue->notifyq,
 					   K_FOREVER, NULL);
 			continue;
 		}
 
-		k_spin_unlock(&lock, key);
+		wl = work_lock(work);
+		k_spin_unlock(&queue->lock, key);
+		k_spin_unlock(&wl->lock, wkey);
 
 		__ASSERT_NO_MSG(handler != NULL);
 		handler(work);
@@ -672,16 +1059,32 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		 * Clear the BUSY flag and optionally yield to prevent
 		 * starving other threads.
 		 */
-		key = k_spin_lock(&lock);
+		wkey = k_spin_lock(&wl->lock);
 
 		flag_clear(&work->flags, K_WORK_RUNNING_BIT);
 		if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
 			finalize_cancel_locked(work);
 		}
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#ifdef CONFIG_WORKQUEUE_POOL
+		finalize_flush_locked(work);
+#endif
+
+		key = k_spin_lock(&queue->lock);
+
+		/* Resubmitted while running on a pool: list it now */
+		if (queue_is_pool(queue) &&
+		    flag_test(&work->flags, K_WORK_QUEUED_BIT)) {
+			sys_slist_append(&queue->pending, &work->node);
+			(void)notify_queue_locked(queue);
+		}
+
+		if (QUEUE_BUSY_DEC(queue)) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(&queue->lock, key);
+		k_spin_unlock(&wl->lock, wkey);
 
 		/* Optionally yield to prevent the work queue from
 		 * starving other threads.
@@ -724,6 +1127,21 @@ void k_work_queue_start(struct k_work_q *queue,
 		flags |= K_WORK_QUEUE_NO_YIELD;
 	}
 
+#ifdef CONFIG_WORKQUEUE_POOL
+	queue->pool_threads = NULL;
+	queue->pool_size = 0U;
+	queue->busy = 0U;
+
+	if ((cfg != NULL) && (cfg->pool_size != 0U)) {
+		__ASSERT_NO_MSG(cfg->pool_size < UINT16_MAX);
+		__ASSERT_NO_MSG(cfg->pool_threads != NULL);
+		__ASSERT_NO_MSG(cfg->pool_stacks != NULL);
+
+		queue->pool_threads = cfg->pool_threads;
+		queue->pool_size = (uint16_t)cfg->pool_size;
+	}
+#endif
+
 	/* It hasn't actually been started yet, but all the state is in place
 	 * so we can submit things and once the thread gets control it's ready
 	 * to roll.
@@ -740,6 +1158,22 @@ void k_work_queue_start(struct k_work_q *queue,
 
 	k_thread_start(&queue->thread);
 
+#ifdef CONFIG_WORKQUEUE_POOL
+	for (size_t i = 0; i < queue->pool_size; i++) {
+		struct k_thread *thread = &queue->pool_threads[i];
+
+		(void)k_thread_create(thread, cfg->pool_stacks[i], stack_size,
+				      work_queue_main, queue, NULL, NULL,
+				      prio, 0, K_FOREVER);
+
+		if (cfg->name != NULL) {
+			k_thread_name_set(thread, cfg->name);
+		}
+
+		k_thread_start(thread);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
@@ -752,7 +1186,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, drain, queue);
 
 	int ret = 0;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
@@ -764,10 +1198,10 @@ int k_work_queue_drain(struct k_work_q *queue,
 		}
 
 		notify_queue_locked(queue);
-		ret = z_sched_wait(&lock, key, &queue->drainq,
+		ret = z_sched_wait(&queue->lock, key, &queue->drainq,
 				   K_FOREVER, NULL);
 	} else {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(&queue->lock, key);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, drain, queue, ret);
@@ -782,13 +1216,13 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, unplug, queue);
 
 	int ret = -EALREADY;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 
 	if (flag_test_and_clear(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT)) {
 		ret = 0;
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&queue->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, unplug, queue, ret);
 
@@ -808,7 +1242,8 @@ static void work_timeout(struct _timeout *to)
 	struct k_work_delayable *dw
 		= CONTAINER_OF(to, struct k_work_delayable, timeout);
 	struct k_work *wp = &dw->work;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(wp);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 	struct k_work_q *queue = NULL;
 
 	/* If the work is still marked delayed (should be) then clear that
@@ -823,7 +1258,7 @@ static void work_timeout(struct _timeout *to)
 		(void)submit_to_queue_locked(wp, &queue);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 }
 
 void k_work_init_delayable(struct k_work_delayable *dwork,
@@ -850,10 +1285,11 @@ static inline int work_delayable_busy_get_locked(const struct k_work_delayable *
 
 int k_work_delayable_busy_get(const struct k_work_delayable *dwork)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(&dwork->work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 	int ret = work_delayable_busy_get_locked(dwork);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 	return ret;
 }
 
@@ -956,15 +1392,16 @@ int k_work_schedule_for_queue(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule_for_queue, queue, dwork, delay);
 
 	struct k_work *work = &dwork->work;
+	struct work_lock *wl = work_lock(work);
 	int ret = 0;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 
 	/* Schedule the work item if it's idle or running. */
 	if ((work_busy_get_locked(work) & ~K_WORK_RUNNING) == 0U) {
 		ret = schedule_for_queue_locked(&queue, dwork, delay);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule_for_queue, queue, dwork, delay, ret);
 
@@ -991,8 +1428,9 @@ int k_work_reschedule_for_queue(struct k_work_q *queue,
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, reschedule_for_queue, queue, dwork, delay);
 
+	struct work_lock *wl = work_lock(&dwork->work);
 	int ret = 0;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 
 	/* Remove any active scheduling. */
 	(void)unschedule_locked(dwork);
@@ -1000,7 +1438,7 @@ int k_work_reschedule_for_queue(struct k_work_q *queue,
 	/* Schedule the work item with the new parameters. */
 	ret = schedule_for_queue_locked(&queue, dwork, delay);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, reschedule_for_queue, queue, dwork, delay, ret);
 
@@ -1025,10 +1463,11 @@ int k_work_cancel_delayable(struct k_work_delayable *dwork)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, cancel_delayable, dwork);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(&dwork->work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 	int ret = cancel_delayable_async_locked(dwork);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, cancel_delayable, dwork, ret);
 
@@ -1048,7 +1487,8 @@ bool k_work_cancel_delayable_sync(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, cancel_delayable_sync, dwork, sync);
 
 	struct z_work_canceller *canceller = &sync->canceller;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(&dwork->work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 	bool pending = (work_delayable_busy_get_locked(dwork) != 0U);
 	bool need_wait = false;
 
@@ -1057,7 +1497,7 @@ bool k_work_cancel_delayable_sync(struct k_work_delayable *dwork,
 		need_wait = cancel_sync_locked(&dwork->work, canceller);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	if (need_wait) {
 		k_sem_take(&canceller->sem, K_FOREVER);
@@ -1081,11 +1521,12 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 
 	struct k_work *work = &dwork->work;
 	struct z_work_flusher *flusher = &sync->flusher;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct work_lock *wl = work_lock(work);
+	k_spinlock_key_t key = k_spin_lock(&wl->lock);
 
 	/* If it's idle release the lock and return immediately. */
 	if (work_busy_get_locked(work) == 0U) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(&wl->lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, flush_delayable, dwork, sync, false);
 
@@ -1104,7 +1545,7 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 	/* Wait for it to finish */
 	bool need_flush = work_flush_locked(work, flusher);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&wl->lock, key);
 
 	/* If necessary wait until the flusher item completes */
 	if (need_flush) {
@@ -0,0 +1,436 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_concurrent.h>
+#include <zephyr/sys/util.h>
+
+#define N_STRIPES CONFIG_SYS_HASH_MAP_CONCURRENT_STRIPES
+
+/*
+ * A key is guarded by the stripe selected by the low bits of its hash. The
+ * table never has fewer buckets than stripes and both are powers of two,
+ * so every bucket belongs to exactly one stripe whatever the table size.
+ */
+BUILD_ASSERT(IS_POWER_OF_TWO(N_STRIPES), "The number of stripes must be a power of two");
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_concurrent_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_concurrent_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_concurrent_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+struct sys_hashmap_concurrent_entry {
+	uint64_t key;
+	uint64_t value;
+	uint32_t hash;
+	sys_dnode_t node;
+};
+
+static inline struct sys_hashmap_concurrent_data *concurrent_data(const struct sys_hashmap *map)
+{
+	return (struct sys_hashmap_concurrent_data *)map->data;
+}
+
+static inline struct k_spinlock *stripe_of(const struct sys_hashmap *map, uint32_t hash)
+{
+	return &concurrent_data(map)->stripes[hash & (N_STRIPES - 1)];
+}
+
+static void lock_all(const struct sys_hashmap *map, k_spinlock_key_t keys[N_STRIPES])
+{
+	/* always in the same order, stripe holders never wait for a second stripe */
+	for (size_t i = 0; i < N_STRIPES; ++i) {
+		keys[i] = k_spin_lock(&concurrent_data(map)->stripes[i]);
+	}
+}
+
+static void unlock_all(const struct sys_hashmap *map, k_spinlock_key_t keys[N_STRIPES])
+{
+	for (size_t i = N_STRIPES; i > 0; --i) {
+		k_spin_unlock(&concurrent_data(map)->stripes[i - 1], keys[i - 1]);
+	}
+}
+
+/* Caller holds the stripe of hash, and the table is not empty */
+static struct sys_hashmap_concurrent_entry *
+sys_hashmap_concurrent_find(const struct sys_hashmap *map, uint64_t key, uint32_t hash)
+{
+	struct sys_hashmap_concurrent_entry *entry;
+	sys_dlist_t *buckets = map->data->buckets;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&buckets[hash & (map->data->n_buckets - 1)], entry, node) {
+		if (entry->key == key) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* Caller holds size_lock */
+static bool sys_hashmap_concurrent_target(const struct sys_hashmap *map, bool grow,
+					  size_t *new_n_buckets)
+{
+	if (!sys_hashmap_should_rehash(map, grow, 0, new_n_buckets)) {
+		return false;
+	}
+
+	/* a table may briefly be left empty while another thread shrinks it */
+	if (grow && map->data->n_buckets != 0) {
+		*new_n_buckets = map->data->n_buckets << 1;
+	}
+
+	if (*new_n_buckets != 0) {
+		*new_n_buckets = MAX(*new_n_buckets, N_STRIPES);
+	}
+
+	return *new_n_buckets != map->data->n_buckets;
+}
+
+/*
+ * Resize the table if it still needs resizing. The new table is allocated
+ * without holding any lock, so the decision is checked again once all
+ * stripes are held and the resize is abandoned if another thread got there
+ * first. Callers retry their operation either way.
+ */
+static int sys_hashmap_concurrent_rehash(struct sys_hashmap *map, bool grow)
+{
+	bool resize;
+	size_t old_n_buckets;
+	size_t new_n_buckets;
+	size_t check_n_buckets;
+	k_spinlock_key_t key;
+	k_spinlock_key_t keys[N_STRIPES];
+	sys_dlist_t *old_buckets;
+	sys_dlist_t *new_buckets = NULL;
+	struct sys_hashmap_concurrent_entry *entry;
+	struct sys_hashmap_concurrent_data *data = concurrent_data(map);
+
+	key = k_spin_lock(&data->size_lock);
+	resize = sys_hashmap_concurrent_target(map, grow, &new_n_buckets);
+	old_n_buckets = data->n_buckets;
+	k_spin_unlock(&data->size_lock, key);
+
+	if (!resize) {
+		return 0;
+	}
+
+	if (new_n_buckets != 0) {
+		new_buckets = map->alloc_func(NULL, new_n_buckets * sizeof(*new_buckets));
+		if (new_buckets == NULL) {
+			return -ENOMEM;
+		}
+
+		for (size_t i = 0; i < new_n_buckets; ++i) {
+			sys_dlist_init(&new_buckets[i]);
+		}
+	}
+
+	lock_all(map, keys);
+	key = k_spin_lock(&data->size_lock);
+
+	if (data->n_buckets != old_n_buckets ||
+	    !sys_hashmap_concurrent_target(map, grow, &check_n_buckets) ||
+	    check_n_buckets != new_n_buckets) {
+		k_spin_unlock(&data->size_lock, key);
+		unlock_all(map, keys);
+
+		if (new_buckets != NULL) {
+			map->alloc_func(new_buckets, 0);
+		}
+
+		return 0;
+	}
+
+	/* move all entries, they keep their hash so none is computed here */
+	old_buckets = data->buckets;
+	for (size_t i = 0; i < old_n_buckets; ++i) {
+		while (!sys_dlist_is_empty(&old_buckets[i])) {
+			entry = CONTAINER_OF(sys_dlist_get(&old_buckets[i]),
+					     struct sys_hashmap_concurrent_entry, node);
+			sys_dlist_append(&new_buckets[entry->hash & (new_n_buckets - 1)],
+					 &entry->node);
+		}
+	}
+
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+
+	k_spin_unlock(&data->size_lock, key);
+	unlock_all(map, keys);
+
+	if (old_buckets != NULL) {
+		map->alloc_func(old_buckets, 0);
+	}
+
+	return 0;
+}
+
+static void sys_hashmap_concurrent_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	k_spinlock_key_t key;
+	struct k_spinlock *stripe;
+	bool found_previous_key = false;
+	struct sys_hashmap_concurrent_entry *entry;
+	const struct sys_hashmap *map = it->map;
+	sys_dlist_t *buckets = map->data->buckets;
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		/* at position 0, state equals the beginning of the bucket array */
+		it->state = buckets;
+		found_previous_key = true;
+	}
+
+	for (i = (sys_dlist_t *)it->state - buckets; i < map->data->n_buckets; ++i) {
+		stripe = stripe_of(map, i);
+		key = k_spin_lock(stripe);
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&buckets[i], entry, node) {
+			if (!found_previous_key) {
+				if (entry->key == it->key) {
+					found_previous_key = true;
+				}
+
+				continue;
+			}
+
+			it->state = &buckets[i];
+			it->key = entry->key;
+			it->value = entry->value;
+			++it->pos;
+
+			k_spin_unlock(stripe, key);
+
+			return;
+		}
+
+		k_spin_unlock(stripe, key);
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Concurrent Hashmap API
+ */
+
+static void sys_hashmap_concurrent_iter(const struct sys_hashmap *map,
+					struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_concurrent_iter_next;
+	it->state = map->data->buckets;
+	it->key = 0;
+	it->value = 0;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_concurrent_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+					 void *cookie)
+{
+	size_t n_buckets;
+	k_spinlock_key_t key;
+	k_spinlock_key_t keys[N_STRIPES];
+	sys_dlist_t *buckets;
+	struct sys_hashmap_concurrent_entry *entry;
+	struct sys_hashmap_concurrent_data *data = concurrent_data(map);
+
+	/* detach the table, then call back and free without holding any lock */
+	lock_all(map, keys);
+	key = k_spin_lock(&data->size_lock);
+
+	buckets = data->buckets;
+	n_buckets = data->n_buckets;
+	data->buckets = NULL;
+	data->n_buckets = 0;
+	data->size = 0;
+
+	k_spin_unlock(&data->size_lock, key);
+	unlock_all(map, keys);
+
+	for (size_t i = 0; i < n_buckets; ++i) {
+		while (!sys_dlist_is_empty(&buckets[i])) {
+			entry = CONTAINER_OF(sys_dlist_get(&buckets[i]),
+					     struct sys_hashmap_concurrent_entry, node);
+
+			if (cb != NULL) {
+				cb(entry->key, entry->value, cookie);
+			}
+
+			map->alloc_func(entry, 0);
+		}
+	}
+
+	if (buckets != NULL) {
+		map->alloc_func(buckets, 0);
+	}
+}
+
+static int sys_hashmap_concurrent_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					 uint64_t *old_value)
+{
+	int ret;
+	bool grow;
+	k_spinlock_key_t skey;
+	k_spinlock_key_t stripe_key;
+	struct k_spinlock *stripe;
+	struct sys_hashmap_concurrent_entry *entry;
+	struct sys_hashmap_concurrent_entry *new_entry;
+	struct sys_hashmap_concurrent_data *data = concurrent_data(map);
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	/* allocate up front, the allocator may not be called with a lock held */
+	new_entry = map->alloc_func(NULL, sizeof(*new_entry));
+	if (new_entry == NULL) {
+		return -ENOMEM;
+	}
+
+	new_entry->key = key;
+	new_entry->value = value;
+	new_entry->hash = hash;
+	sys_dnode_init(&new_entry->node);
+
+	stripe = stripe_of(map, hash);
+
+	for (;;) {
+		stripe_key = k_spin_lock(stripe);
+
+		entry = (data->n_buckets == 0) ? NULL : sys_hashmap_concurrent_find(map, key, hash);
+		if (entry != NULL) {
+			if (old_value != NULL) {
+				*old_value = entry->value;
+			}
+
+			entry->value = value;
+			k_spin_unlock(stripe, stripe_key);
+
+			map->alloc_func(new_entry, 0);
+
+			return 0;
+		}
+
+		skey = k_spin_lock(&data->size_lock);
+		if (data->size == map->config->max_size) {
+			ret = -ENOSPC;
+		} else {
+			grow = data->n_buckets == 0 ||
+			       (data->size + 1) * 100 / data->n_buckets > map->config->load_factor;
+			ret = grow ? 0 : 1;
+			data->size += ret;
+		}
+		k_spin_unlock(&data->size_lock, skey);
+
+		if (ret == 1) {
+			sys_dlist_append(&((sys_dlist_t *)data->buckets)[hash & (data->n_buckets - 1)],
+					 &new_entry->node);
+		}
+
+		k_spin_unlock(stripe, stripe_key);
+
+		if (ret != 0) {
+			break;
+		}
+
+		ret = sys_hashmap_concurrent_rehash(map, true);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	if (ret < 0) {
+		map->alloc_func(new_entry, 0);
+	}
+
+	return ret;
+}
+
+static bool sys_hashmap_concurrent_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	k_spinlock_key_t skey;
+	k_spinlock_key_t stripe_key;
+	struct sys_hashmap_concurrent_entry *entry = NULL;
+	struct sys_hashmap_concurrent_data *data = concurrent_data(map);
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+	struct k_spinlock *stripe = stripe_of(map, hash);
+
+	stripe_key = k_spin_lock(stripe);
+
+	if (data->n_buckets != 0) {
+		entry = sys_hashmap_concurrent_find(map, key, hash);
+	}
+
+	if (entry != NULL) {
+		sys_dlist_remove(&entry->node);
+
+		skey = k_spin_lock(&data->size_lock);
+		--data->size;
+		k_spin_unlock(&data->size_lock, skey);
+
+		if (value != NULL) {
+			*value = entry->value;
+		}
+	}
+
+	k_spin_unlock(stripe, stripe_key);
+
+	if (entry == NULL) {
+		return false;
+	}
+
+	map->alloc_func(entry, 0);
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_concurrent_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_concurrent_get(const struct sys_hashmap *map, uint64_t key,
+				       uint64_t *value)
+{
+	k_spinlock_key_t stripe_key;
+	struct sys_hashmap_concurrent_entry *entry = NULL;
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+	struct k_spinlock *stripe = stripe_of(map, hash);
+
+	stripe_key = k_spin_lock(stripe);
+
+	if (map->data->n_buckets != 0) {
+		entry = sys_hashmap_concurrent_find(map, key, hash);
+	}
+
+	if (entry != NULL && value != NULL) {
+		*value = entry->value;
+	}
+
+	k_spin_unlock(stripe, stripe_key);
+
+	return entry != NULL;
+}
+
+const struct sys_hashmap_api sys_hashmap_concurrent_api = {
+	.iter = sys_hashmap_concurrent_iter,
+	.clear = sys_hashmap_concurrent_clear,
+	.insert = sys_hashmap_concurrent_insert,
+	.remove = sys_hashmap_concurrent_remove,
+	.get = sys_hashmap_concurrent_get,
+};
@@ -80,7 +80,11 @@ static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t
 	struct oalp_entry *entry = NULL;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
 
-	entry = sys_hashmap_oa_lp_find(map, key, true, true, true);
+	/* the key may be stored past a tombstone, look for it first */
+	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
+	if (entry == NULL || entry->state == UNUSED) {
+		entry = sys_hashmap_oa_lp_find(map, key, false, true, true);
+	}
 	__ASSERT_NO_MSG(entry != NULL);
 
 	switch (entry->state) {
@@ -91,7 +95,7 @@ static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t
 	case TOMBSTONE:
 		--data->n_tombstones;
 		++data->size;
-		ret = 0;
+		ret = 1;
 		break;
 	case USED:
 	default:
@@ -144,6 +148,7 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 	}
 
 	data->size = 0;
+	data->n_tombstones = 0;
 	data->buckets = new_buckets;
 	data->n_buckets = new_n_buckets;
 
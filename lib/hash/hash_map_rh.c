@@ -0,0 +1,310 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_rh.h>
+#include <zephyr/sys/util.h>
+
+struct rh_entry {
+	uint64_t key;
+	uint64_t value;
+	/* distance from the ideal bucket plus one, zero for an unused bucket */
+	uint32_t dist;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_rh_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_rh_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_rh_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static struct rh_entry *sys_hashmap_rh_find(const struct sys_hashmap *map, uint64_t key)
+{
+	struct rh_entry *entry;
+	const size_t n_buckets = map->data->n_buckets;
+	struct rh_entry *const buckets = map->data->buckets;
+	uint32_t hash;
+
+	if (n_buckets == 0) {
+		return NULL;
+	}
+
+	hash = map->hash_func(&key, sizeof(key));
+
+	for (size_t j = hash & (n_buckets - 1), dist = 1; dist <= n_buckets;
+	     j = (j + 1) & (n_buckets - 1), ++dist) {
+		entry = &buckets[j];
+
+		/*
+		 * Entries are ordered by distance along a probe sequence, so
+		 * once a bucket is closer to its own ideal position than the
+		 * key would be here, the key cannot be further along.
+		 */
+		if (entry->dist < dist) {
+			return NULL;
+		}
+
+		if (entry->key == key) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* The key must not be in the hashmap yet */
+static void sys_hashmap_rh_insert_no_rehash(struct sys_hashmap *map, uint64_t key, uint64_t value)
+{
+	struct rh_entry tmp;
+	struct rh_entry *entry;
+	const size_t n_buckets = map->data->n_buckets;
+	struct rh_entry *const buckets = map->data->buckets;
+	struct rh_entry cur = {
+		.key = key,
+		.value = value,
+		.dist = 1,
+	};
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	__ASSERT_NO_MSG(map->data->size < n_buckets);
+
+	for (size_t j = hash & (n_buckets - 1);; j = (j + 1) & (n_buckets - 1), ++cur.dist) {
+		entry = &buckets[j];
+
+		if (entry->dist == 0) {
+			*entry = cur;
+			break;
+		}
+
+		/* take the bucket from an entry closer to home, then place that one */
+		if (entry->dist < cur.dist) {
+			tmp = *entry;
+			*entry = cur;
+			cur = tmp;
+		}
+	}
+
+	++map->data->size;
+}
+
+static int sys_hashmap_rh_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_size;
+	size_t old_n_buckets;
+	size_t new_n_buckets = 0;
+	struct rh_entry *entry;
+	struct rh_entry *old_buckets;
+	struct rh_entry *new_buckets = NULL;
+	struct sys_hashmap_rh_data *data = (struct sys_hashmap_rh_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, 0, &new_n_buckets)) {
+		return 0;
+	}
+
+	old_size = data->size;
+	old_n_buckets = data->n_buckets;
+	old_buckets = (struct rh_entry *)data->buckets;
+
+	if (new_n_buckets != 0) {
+		new_buckets = (struct rh_entry *)map->alloc_func(NULL,
+								  new_n_buckets * sizeof(*entry));
+		if (new_buckets == NULL) {
+			return -ENOMEM;
+		}
+
+		/* ensure all buckets are empty / initialized */
+		memset(new_buckets, 0, new_n_buckets * sizeof(*new_buckets));
+	}
+
+	data->size = 0;
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0, j = 0; i < old_n_buckets && j < old_size; ++i) {
+		entry = &old_buckets[i];
+
+		if (entry->dist != 0) {
+			sys_hashmap_rh_insert_no_rehash(map, entry->key, entry->value);
+			++j;
+		}
+	}
+
+	/* free the old Hashmap */
+	if (old_buckets != NULL) {
+		map->alloc_func(old_buckets, 0);
+	}
+
+	return 0;
+}
+
+static void sys_hashmap_rh_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	struct rh_entry *entry;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct rh_entry *buckets = map->data->buckets;
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = buckets;
+	}
+
+	i = (struct rh_entry *)it->state - buckets;
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		entry = &buckets[i];
+		if (entry->dist != 0) {
+			it->state = &buckets[i + 1];
+			it->key = entry->key;
+			it->value = entry->value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Robin Hood Hashmap API
+ */
+
+static void sys_hashmap_rh_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_rh_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_rh_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb, void *cookie)
+{
+	struct rh_entry *entry;
+	struct sys_hashmap_rh_data *data = (struct sys_hashmap_rh_data *)map->data;
+	struct rh_entry *buckets = data->buckets;
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		entry = &buckets[i];
+		if (entry->dist != 0) {
+			cb(entry->key, entry->value, cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+}
+
+static int sys_hashmap_rh_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				 uint64_t *old_value)
+{
+	int ret;
+	struct rh_entry *entry;
+
+	entry = sys_hashmap_rh_find(map, key);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+
+		entry->value = value;
+
+		return 0;
+	}
+
+	if (map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	ret = sys_hashmap_rh_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	sys_hashmap_rh_insert_no_rehash(map, key, value);
+
+	return 1;
+}
+
+static bool sys_hashmap_rh_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t i;
+	size_t n;
+	size_t next;
+	struct rh_entry *entry;
+	struct sys_hashmap_rh_data *data = (struct sys_hashmap_rh_data *)map->data;
+	struct rh_entry *const buckets = data->buckets;
+	const size_t mask = data->n_buckets - 1;
+
+	entry = sys_hashmap_rh_find(map, key);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	/*
+	 * Backward shift: pull the following entries of the probe sequence
+	 * one bucket closer to home, so that no tombstones are needed.
+	 */
+	for (i = entry - buckets, next = (i + 1) & mask, n = 1;
+	     n < data->n_buckets && buckets[next].dist > 1;
+	     i = next, next = (next + 1) & mask, ++n) {
+		buckets[i] = buckets[next];
+		--buckets[i].dist;
+	}
+
+	buckets[i].dist = 0;
+	--data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_rh_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_rh_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct rh_entry *entry;
+
+	entry = sys_hashmap_rh_find(map, key);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_rh_api = {
+	.iter = sys_hashmap_rh_iter,
+	.clear = sys_hashmap_rh_clear,
+	.insert = sys_hashmap_rh_insert,
+	.remove = sys_hashmap_rh_remove,
+	.get = sys_hashmap_rh_get,
+};
@@ -0,0 +1,476 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_swiss.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Every bucket has a control byte, kept in an array of its own after the
+ * entries. A used bucket stores the low 7 bits of the hash of its key, so
+ * a whole group of buckets is filtered with a few vector operations and
+ * keys are only compared for the (rare) false positives.
+ */
+#define CTRL_EMPTY    0x80
+#define CTRL_DELETED  0xfe
+/* pads the control bytes of tables smaller than a group, never matches */
+#define CTRL_SENTINEL 0xff
+
+#define H1(_hash) ((_hash) >> 7)
+#define H2(_hash) ((uint8_t)((_hash) & 0x7f))
+
+/*
+ * Group matching returns a bit mask with one bit set per matching bucket,
+ * GROUP_SHIFT converts the position of a set bit into a bucket index.
+ */
+#if defined(__SSE2__)
+#define GROUP_WIDTH 16
+#define GROUP_SHIFT 0
+
+static inline uint64_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	__m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+
+	return (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)h2)));
+}
+
+static inline uint64_t group_match_empty(const uint8_t *ctrl)
+{
+	__m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+
+	return (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)CTRL_EMPTY)));
+}
+
+static inline uint64_t group_match_empty_or_deleted(const uint8_t *ctrl)
+{
+	__m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+
+	/* signed, only EMPTY and DELETED are below SENTINEL (-1) */
+	return (uint16_t)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8((char)CTRL_SENTINEL), g));
+}
+
+#elif defined(__ARM_NEON)
+#define GROUP_WIDTH 16
+#define GROUP_SHIFT 2
+
+/* Narrow a byte mask to one bit per 4-bit lane */
+static inline uint64_t group_mask(uint8x16_t match)
+{
+	uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(match), 4);
+
+	return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL;
+}
+
+static inline uint64_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	return group_mask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(h2)));
+}
+
+static inline uint64_t group_match_empty(const uint8_t *ctrl)
+{
+	return group_mask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(CTRL_EMPTY)));
+}
+
+static inline uint64_t group_match_empty_or_deleted(const uint8_t *ctrl)
+{
+	int8x16_t g = vreinterpretq_s8_u8(vld1q_u8(ctrl));
+
+	return group_mask(vcltq_s8(g, vdupq_n_s8((int8_t)CTRL_SENTINEL)));
+}
+
+#else
+#define GROUP_WIDTH 8
+#define GROUP_SHIFT 3
+
+#define GROUP_LSBS 0x0101010101010101ULL
+#define GROUP_MSBS 0x8080808080808080ULL
+
+static inline uint64_t group_load(const uint8_t *ctrl)
+{
+	uint64_t g;
+
+	memcpy(&g, ctrl, sizeof(g));
+
+	return sys_le64_to_cpu(g);
+}
+
+static inline uint64_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	uint64_t x = group_load(ctrl) ^ (GROUP_LSBS * h2);
+
+	/* may report a false positive above a real match, keys are compared anyway */
+	return (x - GROUP_LSBS) & ~x & GROUP_MSBS;
+}
+
+static inline uint64_t group_match_empty(const uint8_t *ctrl)
+{
+	uint64_t g = group_load(ctrl);
+
+	/* high bit set and bit 1 clear is only true for EMPTY */
+	return g & ~(g << 6) & GROUP_MSBS;
+}
+
+static inline uint64_t group_match_empty_or_deleted(const uint8_t *ctrl)
+{
+	uint64_t g = group_load(ctrl);
+
+	/* high bit set and bit 0 clear excludes SENTINEL */
+	return g & ~(g << 7) & GROUP_MSBS;
+}
+#endif
+
+/* Index within the group of the lowest bit set in a match */
+#define GROUP_INDEX(_mask) ((size_t)__builtin_ctzll(_mask) >> GROUP_SHIFT)
+
+struct swiss_entry {
+	uint64_t key;
+	uint64_t value;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+/* Control bytes, padded up to one group for small tables */
+static inline size_t ctrl_size(size_t n_buckets)
+{
+	return MAX(n_buckets, GROUP_WIDTH);
+}
+
+static inline size_t n_groups(size_t n_buckets)
+{
+	return MAX(n_buckets / GROUP_WIDTH, 1);
+}
+
+static inline uint8_t *ctrl_of(const struct sys_hashmap_data *data)
+{
+	return (uint8_t *)data->buckets + data->n_buckets * sizeof(struct swiss_entry);
+}
+
+static inline bool ctrl_is_used(uint8_t ctrl)
+{
+	return (ctrl & CTRL_EMPTY) == 0;
+}
+
+/*
+ * Visit the groups of a probe sequence. Stepping by 1, 2, 3, ... groups
+ * reaches every group of a power of two sized table exactly once.
+ */
+#define FOR_EACH_PROBE_GROUP(_n_groups, _hash, _group, _i)                                        \
+	for (size_t _i = 0, _group = H1(_hash) & ((_n_groups) - 1); _i < (_n_groups);             \
+	     ++_i, _group = (_group + _i) & ((_n_groups) - 1))
+
+static struct swiss_entry *sys_hashmap_swiss_find(const struct sys_hashmap *map, uint64_t key)
+{
+	uint64_t match;
+	uint32_t hash;
+	const uint8_t *group_ctrl;
+	const size_t n_buckets = map->data->n_buckets;
+	struct swiss_entry *const buckets = map->data->buckets;
+	const uint8_t *const ctrl = ctrl_of(map->data);
+	size_t j;
+
+	if (n_buckets == 0) {
+		return NULL;
+	}
+
+	hash = map->hash_func(&key, sizeof(key));
+
+	FOR_EACH_PROBE_GROUP(n_groups(n_buckets), hash, group, i) {
+		group_ctrl = &ctrl[group * GROUP_WIDTH];
+
+		for (match = group_match(group_ctrl, H2(hash)); match != 0; match &= match - 1) {
+			j = group * GROUP_WIDTH + GROUP_INDEX(match);
+			if (buckets[j].key == key) {
+				return &buckets[j];
+			}
+		}
+
+		/* the key would have been placed in this group */
+		if (group_match_empty(group_ctrl) != 0) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+/* The key must not be in the hashmap yet */
+static void sys_hashmap_swiss_insert_no_rehash(struct sys_hashmap *map, uint64_t key,
+					       uint64_t value)
+{
+	uint64_t match;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_entry *const buckets = data->buckets;
+	uint8_t *const ctrl = ctrl_of(map->data);
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+	size_t j;
+
+	__ASSERT_NO_MSG(data->size < data->n_buckets);
+
+	FOR_EACH_PROBE_GROUP(n_groups(data->n_buckets), hash, group, i) {
+		match = group_match_empty_or_deleted(&ctrl[group * GROUP_WIDTH]);
+		if (match == 0) {
+			continue;
+		}
+
+		j = group * GROUP_WIDTH + GROUP_INDEX(match);
+		if (ctrl[j] == CTRL_DELETED) {
+			--data->n_tombstones;
+		}
+
+		ctrl[j] = H2(hash);
+		buckets[j].key = key;
+		buckets[j].value = value;
+		++data->size;
+
+		return;
+	}
+
+	__ASSERT(false, "No free bucket in the Hashmap");
+}
+
+static int sys_hashmap_swiss_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_size;
+	size_t old_n_buckets;
+	size_t new_n_buckets = 0;
+	uint8_t *old_ctrl;
+	uint8_t *new_ctrl;
+	struct swiss_entry *old_buckets;
+	struct swiss_entry *new_buckets = NULL;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, data->n_tombstones, &new_n_buckets)) {
+		return 0;
+	}
+
+	/*
+	 * When only the tombstones push the table over its load factor,
+	 * rebuild it at the same size. Otherwise insert / remove churn would
+	 * keep doubling the table.
+	 */
+	if (grow && data->n_buckets != 0 &&
+	    (data->size + 1) * 100 / data->n_buckets <= map->config->load_factor) {
+		new_n_buckets = data->n_buckets;
+	}
+
+	old_size = data->size;
+	old_n_buckets = data->n_buckets;
+	old_buckets = (struct swiss_entry *)data->buckets;
+	old_ctrl = ctrl_of(map->data);
+
+	if (new_n_buckets != 0) {
+		new_buckets = (struct swiss_entry *)map->alloc_func(
+			NULL, new_n_buckets * sizeof(*new_buckets) + ctrl_size(new_n_buckets));
+		if (new_buckets == NULL) {
+			return -ENOMEM;
+		}
+
+		/* ensure all buckets are empty / initialized */
+		new_ctrl = (uint8_t *)&new_buckets[new_n_buckets];
+		memset(new_ctrl, CTRL_EMPTY, new_n_buckets);
+		memset(&new_ctrl[new_n_buckets], CTRL_SENTINEL,
+		       ctrl_size(new_n_buckets) - new_n_buckets);
+	}
+
+	data->size = 0;
+	data->n_tombstones = 0;
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0, j = 0; i < old_n_buckets && j < old_size; ++i) {
+		if (ctrl_is_used(old_ctrl[i])) {
+			sys_hashmap_swiss_insert_no_rehash(map, old_buckets[i].key,
+							   old_buckets[i].value);
+			++j;
+		}
+	}
+
+	/* free the old Hashmap */
+	if (old_buckets != NULL) {
+		map->alloc_func(old_buckets, 0);
+	}
+
+	return 0;
+}
+
+static void sys_hashmap_swiss_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct swiss_entry *buckets = map->data->buckets;
+	const uint8_t *const ctrl = ctrl_of(map->data);
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = buckets;
+	}
+
+	i = (struct swiss_entry *)it->state - buckets;
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		if (ctrl_is_used(ctrl[i])) {
+			it->state = &buckets[i + 1];
+			it->key = buckets[i].key;
+			it->value = buckets[i].value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Swiss Table Hashmap API
+ */
+
+static void sys_hashmap_swiss_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_swiss_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_swiss_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_entry *buckets = data->buckets;
+	const uint8_t *const ctrl = ctrl_of(map->data);
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		if (ctrl_is_used(ctrl[i])) {
+			cb(buckets[i].key, buckets[i].value, cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+	data->n_tombstones = 0;
+}
+
+static int sys_hashmap_swiss_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				    uint64_t *old_value)
+{
+	int ret;
+	struct swiss_entry *entry;
+
+	entry = sys_hashmap_swiss_find(map, key);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+
+		entry->value = value;
+
+		return 0;
+	}
+
+	if (map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	ret = sys_hashmap_swiss_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	sys_hashmap_swiss_insert_no_rehash(map, key, value);
+
+	return 1;
+}
+
+static bool sys_hashmap_swiss_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t j;
+	struct swiss_entry *entry;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	uint8_t *const ctrl = ctrl_of(map->data);
+
+	entry = sys_hashmap_swiss_find(map, key);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	/*
+	 * A group that still has an empty bucket has never been full, so no
+	 * probe sequence went past it and the bucket can simply be emptied.
+	 * The same is true when there is only one group to probe.
+	 */
+	j = entry - (struct swiss_entry *)data->buckets;
+	if (n_groups(data->n_buckets) == 1 ||
+	    group_match_empty(&ctrl[j - j % GROUP_WIDTH]) != 0) {
+		ctrl[j] = CTRL_EMPTY;
+	} else {
+		ctrl[j] = CTRL_DELETED;
+		++data->n_tombstones;
+	}
+
+	--data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_swiss_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_swiss_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct swiss_entry *entry;
+
+	entry = sys_hashmap_swiss_find(map, key);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_swiss_api = {
+	.iter = sys_hashmap_swiss_iter,
+	.clear = sys_hashmap_swiss_clear,
+	.insert = sys_hashmap_swiss_insert,
+	.remove = sys_hashmap_swiss_remove,
+	.get = sys_hashmap_swiss_get,
+};
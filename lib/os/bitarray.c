@@ -157,6 +157,164 @@ mismatch:
 	return false;
 }
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+/* Number of bits represented by one summary group */
+#define group_bitness(ba)	(_SYS_BITARRAY_SUMMARY_GROUP * bundle_bitness(ba))
+
+#define num_groups(ba)		DIV_ROUND_UP(ba->num_bundles, _SYS_BITARRAY_SUMMARY_GROUP)
+
+/* Number of valid bits in a group, only the last group can be short */
+static size_t group_bits(sys_bitarray_t *bitarray, size_t grp)
+{
+	size_t start = grp * group_bitness(bitarray);
+
+	return MIN(start + group_bitness(bitarray), bitarray->num_bits) - start;
+}
+
+/* Bundle with the bits past the end of the bit array marked as used */
+static uint32_t bundle_used(sys_bitarray_t *bitarray, size_t idx)
+{
+	uint32_t bundle = bitarray->bundles[idx];
+	size_t valid = bitarray->num_bits - idx * bundle_bitness(bitarray);
+
+	if (valid < bundle_bitness(bitarray)) {
+		bundle |= ~(BIT(valid) - 1);
+	}
+
+	return bundle;
+}
+
+/* Longest run of cleared bits in a bundle */
+static uint32_t bundle_longest_free(uint32_t bundle)
+{
+	uint32_t free_bits = ~bundle;
+	uint32_t len = 0;
+
+	while (free_bits != 0U) {
+		free_bits &= free_bits >> 1;
+		len++;
+	}
+
+	return len;
+}
+
+static void summary_update_group(sys_bitarray_t *bitarray, size_t grp)
+{
+	struct sys_bitarray_summary *s = &bitarray->summary[grp];
+	size_t sidx = grp * _SYS_BITARRAY_SUMMARY_GROUP;
+	size_t eidx = MIN(sidx + _SYS_BITARRAY_SUMMARY_GROUP,
+			  bitarray->num_bundles);
+	uint32_t run = 0, longest = 0, head = 0;
+	bool in_head = true;
+
+	for (size_t idx = sidx; idx < eidx; idx++) {
+		uint32_t bundle = bundle_used(bitarray, idx);
+
+		if (bundle == 0U) {
+			run += bundle_bitness(bitarray);
+			continue;
+		}
+
+		/* The low bits close the current run */
+		run += find_lsb_set(bundle) - 1;
+		if (in_head) {
+			head = run;
+			in_head = false;
+		}
+		longest = MAX(longest, run);
+		longest = MAX(longest, bundle_longest_free(bundle));
+
+		/* The high bits start a new one */
+		run = bundle_bitness(bitarray) - find_msb_set(bundle);
+	}
+
+	s->head = in_head ? run : head;
+	s->tail = run;
+	s->longest = MAX(longest, run);
+}
+
+/* Bring the summary up to date after bundles sidx to eidx changed */
+static void summary_update(sys_bitarray_t *bitarray, size_t sidx, size_t eidx)
+{
+	if (!bitarray->summary_valid) {
+		return;
+	}
+
+	for (size_t grp = sidx / _SYS_BITARRAY_SUMMARY_GROUP;
+	     grp <= eidx / _SYS_BITARRAY_SUMMARY_GROUP; grp++) {
+		summary_update_group(bitarray, grp);
+	}
+}
+
+static void summary_build(sys_bitarray_t *bitarray)
+{
+	for (size_t grp = 0; grp < num_groups(bitarray); grp++) {
+		summary_update_group(bitarray, grp);
+	}
+
+	bitarray->summary_valid = true;
+}
+
+/*
+ * Find where to start searching for a free region of num_bits.
+ *
+ * Walks the summary, carrying the free run at the end of each group
+ * over to the next, so groups without room are skipped without looking
+ * at their bundles. This gives the same first fit as a linear scan.
+ *
+ * @param[in]  bitarray Bitarray struct
+ * @param[in]  num_bits Number of bits in the region
+ * @param[out] bit_idx  Bit to start the search at
+ *
+ * @retval     true     If bit_idx starts a free region of num_bits
+ * @retval     false    If the region starts in the group at bit_idx
+ *                      and has yet to be located, or if there is
+ *                      no free region of num_bits (bit_idx is then
+ *                      past the end of the bit array)
+ */
+static bool summary_find(sys_bitarray_t *bitarray, size_t num_bits,
+			 size_t *bit_idx)
+{
+	size_t run_start = 0, run_len = 0;
+
+	if (!bitarray->summary_valid) {
+		summary_build(bitarray);
+	}
+
+	for (size_t grp = 0; grp < num_groups(bitarray); grp++) {
+		struct sys_bitarray_summary *s = &bitarray->summary[grp];
+		size_t grp_start = grp * group_bitness(bitarray);
+		size_t grp_bits = group_bits(bitarray, grp);
+
+		if ((run_len + s->head) >= num_bits) {
+			/* Run carried over from earlier groups fits */
+			*bit_idx = (run_len == 0) ? grp_start : run_start;
+			return true;
+		}
+
+		if (s->longest >= num_bits) {
+			/* Fits somewhere inside this group */
+			*bit_idx = grp_start + s->head;
+			return false;
+		}
+
+		if (s->head == grp_bits) {
+			/* Whole group is free, extend the run */
+			if (run_len == 0) {
+				run_start = grp_start;
+			}
+			run_len += grp_bits;
+		} else {
+			run_start = grp_start + grp_bits - s->tail;
+			run_len = s->tail;
+		}
+	}
+
+	*bit_idx = bitarray->num_bits;
+	return false;
+}
+#endif /* CONFIG_SYS_BITARRAY_SUMMARY */
+
 /*
  * Set or clear a region of bits.
  *
@@ -208,6 +366,10 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 			}
 		}
 	}
+
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	summary_update(bitarray, bd->sidx, bd->eidx);
+#endif
 }
 
 int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
@@ -231,6 +393,10 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 
 	bitarray->bundles[idx] |= BIT(off);
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	summary_update(bitarray, idx, idx);
+#endif
+
 	ret = 0;
 
 out:
@@ -259,6 +425,10 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 
 	bitarray->bundles[idx] &= ~BIT(off);
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	summary_update(bitarray, idx, idx);
+#endif
+
 	ret = 0;
 
 out:
@@ -335,6 +505,10 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 
 	bitarray->bundles[idx] |= BIT(off);
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	summary_update(bitarray, idx, idx);
+#endif
+
 	ret = 0;
 
 out:
@@ -374,6 +548,10 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 
 	bitarray->bundles[idx] &= ~BIT(off);
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	summary_update(bitarray, idx, idx);
+#endif
+
 	ret = 0;
 
 out:
@@ -381,6 +559,35 @@ out:
 	return ret;
 }
 
+/*
+ * Find the first non-allocated bit by looking at bundles
+ * instead of individual bits.
+ *
+ * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
+ * So don't use this on RISCV64.
+ */
+static uint32_t first_free_bit(sys_bitarray_t *bitarray)
+{
+	uint32_t bit_idx = 0;
+
+	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
+		if (~bitarray->bundles[idx] == 0U) {
+			/* bundle is all 1s => all allocated, skip */
+			bit_idx += bundle_bitness(bitarray);
+			continue;
+		}
+
+		if (bitarray->bundles[idx] != 0U) {
+			/* Find the first free bit in bundle if not all free */
+			bit_idx += find_lsb_set(~bitarray->bundles[idx]) - 1;
+		}
+
+		break;
+	}
+
+	return bit_idx;
+}
+
 int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset)
 {
@@ -388,8 +595,11 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 	uint32_t bit_idx;
 	int ret;
 	struct bundle_data bd;
-	size_t off_start, off_end;
+	size_t off_end;
 	size_t mismatch;
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	size_t off_start;
+#endif
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
@@ -406,29 +616,23 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	if (bitarray->summary == NULL) {
+		/* Not created by SYS_BITARRAY_DEFINE(), scan linearly */
+		bit_idx = first_free_bit(bitarray);
+	} else if (summary_find(bitarray, num_bits, &off_start)) {
+		/* The summary skipped the groups without enough room */
+		set_region(bitarray, off_start, num_bits, true, NULL);
 
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
-	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
+		*offset = off_start;
+		ret = 0;
+		goto out;
+	} else {
+		bit_idx = off_start;
 	}
+#else
+	bit_idx = first_free_bit(bitarray);
+#endif
 
 	off_end = bitarray->num_bits - num_bits;
 	ret = -ENOSPC;
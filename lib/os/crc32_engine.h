@@ -0,0 +1,119 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * CRC-32 update kernels shared by crc32_sw.c and crc32c_sw.c. All of them
+ * work on the reflected CRC register, without the initial and final
+ * inversions, so a polynomial is selected by passing its tables or by
+ * picking the matching instruction.
+ */
+
+#ifndef ZEPHYR_LIB_OS_CRC32_ENGINE_H_
+#define ZEPHYR_LIB_OS_CRC32_ENGINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Pulled in ahead of byteorder.h, hosted C libraries may declare their own
+ * byte swapping helpers from these.
+ */
+#if defined(CONFIG_CRC_HW) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#elif defined(CONFIG_CRC_HW) && defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+#include <zephyr/sys/byteorder.h>
+
+#if CONFIG_CRC32_SLICES > 0
+extern const uint32_t crc32_ieee_table[CONFIG_CRC32_SLICES][256];
+extern const uint32_t crc32c_table[CONFIG_CRC32_SLICES][256];
+
+static inline uint32_t crc32_sliced_update(const uint32_t table[][256],
+					   uint32_t crc, const uint8_t *data,
+					   size_t len)
+{
+#if CONFIG_CRC32_SLICES >= 8
+	for (; len >= 8; len -= 8, data += 8) {
+		uint32_t lo = crc ^ sys_get_le32(data);
+		uint32_t hi = sys_get_le32(data + 4);
+
+		crc = table[7][lo & 0xff] ^ table[6][(lo >> 8) & 0xff] ^
+		      table[5][(lo >> 16) & 0xff] ^ table[4][lo >> 24] ^
+		      table[3][hi & 0xff] ^ table[2][(hi >> 8) & 0xff] ^
+		      table[1][(hi >> 16) & 0xff] ^ table[0][hi >> 24];
+	}
+#elif CONFIG_CRC32_SLICES >= 4
+	for (; len >= 4; len -= 4, data += 4) {
+		crc ^= sys_get_le32(data);
+		crc = table[3][crc & 0xff] ^ table[2][(crc >> 8) & 0xff] ^
+		      table[1][(crc >> 16) & 0xff] ^ table[0][crc >> 24];
+	}
+#endif
+
+	for (; len > 0; len--) {
+		crc = table[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+	}
+
+	return crc;
+}
+#endif /* CONFIG_CRC32_SLICES > 0 */
+
+#if defined(CONFIG_CRC_HW) && defined(__ARM_FEATURE_CRC32)
+#define CRC32_HW_IEEE 1
+#define CRC32_HW_C 1
+
+/* ARMv8 CRC32 instructions, available for both polynomials */
+static inline uint32_t crc32_ieee_hw_update(uint32_t crc, const uint8_t *data,
+					    size_t len)
+{
+	for (; len >= 8; len -= 8, data += 8) {
+		crc = __crc32d(crc, sys_get_le64(data));
+	}
+	for (; len > 0; len--) {
+		crc = __crc32b(crc, *data++);
+	}
+
+	return crc;
+}
+
+static inline uint32_t crc32c_hw_update(uint32_t crc, const uint8_t *data,
+					size_t len)
+{
+	for (; len >= 8; len -= 8, data += 8) {
+		crc = __crc32cd(crc, sys_get_le64(data));
+	}
+	for (; len > 0; len--) {
+		crc = __crc32cb(crc, *data++);
+	}
+
+	return crc;
+}
+
+#elif defined(CONFIG_CRC_HW) && defined(__SSE4_2__)
+/* The SSE4.2 crc32 instruction only implements CRC-32C */
+#define CRC32_HW_C 1
+
+static inline uint32_t crc32c_hw_update(uint32_t crc, const uint8_t *data,
+					size_t len)
+{
+#ifdef __x86_64__
+	for (; len >= 8; len -= 8, data += 8) {
+		crc = (uint32_t)_mm_crc32_u64(crc, sys_get_le64(data));
+	}
+#endif
+	for (; len >= 4; len -= 4, data += 4) {
+		crc = _mm_crc32_u32(crc, sys_get_le32(data));
+	}
+	for (; len > 0; len--) {
+		crc = _mm_crc32_u8(crc, *data++);
+	}
+
+	return crc;
+}
+#endif /* CONFIG_CRC_HW */
+
+#endif /* ZEPHYR_LIB_OS_CRC32_ENGINE_H_ */
@@ -0,0 +1,1092 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Slice-by-N tables for the reflected CRC-32 polynomials.
+ *
+ * table[0][i] is the CRC of the byte i, computed bit by bit. Each further
+ * table is derived from the previous one as
+ *
+ *   table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xff]
+ *
+ * that is the CRC of the byte i followed by k zero bytes. Only the tables
+ * needed by CONFIG_CRC32_SLICES are built in.
+ */
+
+#include "crc32_engine.h"
+
+
+/* CRC-32 (IEEE 802.3), reflected polynomial 0xEDB88320 */
+const uint32_t crc32_ieee_table[CONFIG_CRC32_SLICES][256] = {
+	{
+		0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU,
+		0x076DC419U, 0x706AF48FU, 0xE963A535U, 0x9E6495A3U,
+		0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U,
+		0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U,
+		0x1DB71064U, 0x6AB020F2U, 0xF3B97148U, 0x84BE41DEU,
+		0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+		0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU,
+		0x14015C4FU, 0x63066CD9U, 0xFA0F3D63U, 0x8D080DF5U,
+		0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U,
+		0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU,
+		0x35B5A8FAU, 0x42B2986CU, 0xDBBBC9D6U, 0xACBCF940U,
+		0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+		0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U,
+		0x21B4F4B5U, 0x56B3C423U, 0xCFBA9599U, 0xB8BDA50FU,
+		0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U,
+		0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU,
+		0x76DC4190U, 0x01DB7106U, 0x98D220BCU, 0xEFD5102AU,
+		0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+		0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U,
+		0x7F6A0DBBU, 0x086D3D2DU, 0x91646C97U, 0xE6635C01U,
+		0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU,
+		0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U,
+		0x65B0D9C6U, 0x12B7E950U, 0x8BBEB8EAU, 0xFCB9887CU,
+		0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+		0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U,
+		0x4ADFA541U, 0x3DD895D7U, 0xA4D1C46DU, 0xD3D6F4FBU,
+		0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U,
+		0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U,
+		0x5005713CU, 0x270241AAU, 0xBE0B1010U, 0xC90C2086U,
+		0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+		0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U,
+		0x59B33D17U, 0x2EB40D81U, 0xB7BD5C3BU, 0xC0BA6CADU,
+		0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU,
+		0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U,
+		0xE3630B12U, 0x94643B84U, 0x0D6D6A3EU, 0x7A6A5AA8U,
+		0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+		0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU,
+		0xF762575DU, 0x806567CBU, 0x196C3671U, 0x6E6B06E7U,
+		0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU,
+		0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U,
+		0xD6D6A3E8U, 0xA1D1937EU, 0x38D8C2C4U, 0x4FDFF252U,
+		0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+		0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U,
+		0xDF60EFC3U, 0xA867DF55U, 0x316E8EEFU, 0x4669BE79U,
+		0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U,
+		0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU,
+		0xC5BA3BBEU, 0xB2BD0B28U, 0x2BB45A92U, 0x5CB36A04U,
+		0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+		0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU,
+		0x9C0906A9U, 0xEB0E363FU, 0x72076785U, 0x05005713U,
+		0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U,
+		0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U,
+		0x86D3D2D4U, 0xF1D4E242U, 0x68DDB3F8U, 0x1FDA836EU,
+		0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+		0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU,
+		0x8F659EFFU, 0xF862AE69U, 0x616BFFD3U, 0x166CCF45U,
+		0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U,
+		0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU,
+		0xAED16A4AU, 0xD9D65ADCU, 0x40DF0B66U, 0x37D83BF0U,
+		0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+		0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U,
+		0xBAD03605U, 0xCDD70693U, 0x54DE5729U, 0x23D967BFU,
+		0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U,
+		0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU,
+	},
+#if CONFIG_CRC32_SLICES >= 4
+	{
+		0x00000000U, 0x191B3141U, 0x32366282U, 0x2B2D53C3U,
+		0x646CC504U, 0x7D77F445U, 0x565AA786U, 0x4F4196C7U,
+		0xC8D98A08U, 0xD1C2BB49U, 0xFAEFE88AU, 0xE3F4D9CBU,
+		0xACB54F0CU, 0xB5AE7E4DU, 0x9E832D8EU, 0x87981CCFU,
+		0x4AC21251U, 0x53D92310U, 0x78F470D3U, 0x61EF4192U,
+		0x2EAED755U, 0x37B5E614U, 0x1C98B5D7U, 0x05838496U,
+		0x821B9859U, 0x9B00A918U, 0xB02DFADBU, 0xA936CB9AU,
+		0xE6775D5DU, 0xFF6C6C1CU, 0xD4413FDFU, 0xCD5A0E9EU,
+		0x958424A2U, 0x8C9F15E3U, 0xA7B24620U, 0xBEA97761U,
+		0xF1E8E1A6U, 0xE8F3D0E7U, 0xC3DE8324U, 0xDAC5B265U,
+		0x5D5DAEAAU, 0x44469FEBU, 0x6F6BCC28U, 0x7670FD69U,
+		0x39316BAEU, 0x202A5AEFU, 0x0B07092CU, 0x121C386DU,
+		0xDF4636F3U, 0xC65D07B2U, 0xED705471U, 0xF46B6530U,
+		0xBB2AF3F7U, 0xA231C2B6U, 0x891C9175U, 0x9007A034U,
+		0x179FBCFBU, 0x0E848DBAU, 0x25A9DE79U, 0x3CB2EF38U,
+		0x73F379FFU, 0x6AE848BEU, 0x41C51B7DU, 0x58DE2A3CU,
+		0xF0794F05U, 0xE9627E44U, 0xC24F2D87U, 0xDB541CC6U,
+		0x94158A01U, 0x8D0EBB40U, 0xA623E883U, 0xBF38D9C2U,
+		0x38A0C50DU, 0x21BBF44CU, 0x0A96A78FU, 0x138D96CEU,
+		0x5CCC0009U, 0x45D73148U, 0x6EFA628BU, 0x77E153CAU,
+		0xBABB5D54U, 0xA3A06C15U, 0x888D3FD6U, 0x91960E97U,
+		0xDED79850U, 0xC7CCA911U, 0xECE1FAD2U, 0xF5FACB93U,
+		0x7262D75CU, 0x6B79E61DU, 0x4054B5DEU, 0x594F849FU,
+		0x160E1258U, 0x0F152319U, 0x243870DAU, 0x3D23419BU,
+		0x65FD6BA7U, 0x7CE65AE6U, 0x57CB0925U, 0x4ED03864U,
+		0x0191AEA3U, 0x188A9FE2U, 0x33A7CC21U, 0x2ABCFD60U,
+		0xAD24E1AFU, 0xB43FD0EEU, 0x9F12832DU, 0x8609B26CU,
+		0xC94824ABU, 0xD05315EAU, 0xFB7E4629U, 0xE2657768U,
+		0x2F3F79F6U, 0x362448B7U, 0x1D091B74U, 0x04122A35U,
+		0x4B53BCF2U, 0x52488DB3U, 0x7965DE70U, 0x607EEF31U,
+		0xE7E6F3FEU, 0xFEFDC2BFU, 0xD5D0917CU, 0xCCCBA03DU,
+		0x838A36FAU, 0x9A9107BBU, 0xB1BC5478U, 0xA8A76539U,
+		0x3B83984BU, 0x2298A90AU, 0x09B5FAC9U, 0x10AECB88U,
+		0x5FEF5D4FU, 0x46F46C0EU, 0x6DD93FCDU, 0x74C20E8CU,
+		0xF35A1243U, 0xEA412302U, 0xC16C70C1U, 0xD8774180U,
+		0x9736D747U, 0x8E2DE606U, 0xA500B5C5U, 0xBC1B8484U,
+		0x71418A1AU, 0x685ABB5BU, 0x4377E898U, 0x5A6CD9D9U,
+		0x152D4F1EU, 0x0C367E5FU, 0x271B2D9CU, 0x3E001CDDU,
+		0xB9980012U, 0xA0833153U, 0x8BAE6290U, 0x92B553D1U,
+		0xDDF4C516U, 0xC4EFF457U, 0xEFC2A794U, 0xF6D996D5U,
+		0xAE07BCE9U, 0xB71C8DA8U, 0x9C31DE6BU, 0x852AEF2AU,
+		0xCA6B79EDU, 0xD37048ACU, 0xF85D1B6FU, 0xE1462A2EU,
+		0x66DE36E1U, 0x7FC507A0U, 0x54E85463U, 0x4DF36522U,
+		0x02B2F3E5U, 0x1BA9C2A4U, 0x30849167U, 0x299FA026U,
+		0xE4C5AEB8U, 0xFDDE9FF9U, 0xD6F3CC3AU, 0xCFE8FD7BU,
+		0x80A96BBCU, 0x99B25AFDU, 0xB29F093EU, 0xAB84387FU,
+		0x2C1C24B0U, 0x350715F1U, 0x1E2A4632U, 0x07317773U,
+		0x4870E1B4U, 0x516BD0F5U, 0x7A468336U, 0x635DB277U,
+		0xCBFAD74EU, 0xD2E1E60FU, 0xF9CCB5CCU, 0xE0D7848DU,
+		0xAF96124AU, 0xB68D230BU, 0x9DA070C8U, 0x84BB4189U,
+		0x03235D46U, 0x1A386C07U, 0x31153FC4U, 0x280E0E85U,
+		0x674F9842U, 0x7E54A903U, 0x5579FAC0U, 0x4C62CB81U,
+		0x8138C51FU, 0x9823F45EU, 0xB30EA79DU, 0xAA1596DCU,
+		0xE554001BU, 0xFC4F315AU, 0xD7626299U, 0xCE7953D8U,
+		0x49E14F17U, 0x50FA7E56U, 0x7BD72D95U, 0x62CC1CD4U,
+		0x2D8D8A13U, 0x3496BB52U, 0x1FBBE891U, 0x06A0D9D0U,
+		0x5E7EF3ECU, 0x4765C2ADU, 0x6C48916EU, 0x7553A02FU,
+		0x3A1236E8U, 0x230907A9U, 0x0824546AU, 0x113F652BU,
+		0x96A779E4U, 0x8FBC48A5U, 0xA4911B66U, 0xBD8A2A27U,
+		0xF2CBBCE0U, 0xEBD08DA1U, 0xC0FDDE62U, 0xD9E6EF23U,
+		0x14BCE1BDU, 0x0DA7D0FCU, 0x268A833FU, 0x3F91B27EU,
+		0x70D024B9U, 0x69CB15F8U, 0x42E6463BU, 0x5BFD777AU,
+		0xDC656BB5U, 0xC57E5AF4U, 0xEE530937U, 0xF7483876U,
+		0xB809AEB1U, 0xA1129FF0U, 0x8A3FCC33U, 0x9324FD72U,
+	},
+	{
+		0x00000000U, 0x01C26A37U, 0x0384D46EU, 0x0246BE59U,
+		0x0709A8DCU, 0x06CBC2EBU, 0x048D7CB2U, 0x054F1685U,
+		0x0E1351B8U, 0x0FD13B8FU, 0x0D9785D6U, 0x0C55EFE1U,
+		0x091AF964U, 0x08D89353U, 0x0A9E2D0AU, 0x0B5C473DU,
+		0x1C26A370U, 0x1DE4C947U, 0x1FA2771EU, 0x1E601D29U,
+		0x1B2F0BACU, 0x1AED619BU, 0x18ABDFC2U, 0x1969B5F5U,
+		0x1235F2C8U, 0x13F798FFU, 0x11B126A6U, 0x10734C91U,
+		0x153C5A14U, 0x14FE3023U, 0x16B88E7AU, 0x177AE44DU,
+		0x384D46E0U, 0x398F2CD7U, 0x3BC9928EU, 0x3A0BF8B9U,
+		0x3F44EE3CU, 0x3E86840BU, 0x3CC03A52U, 0x3D025065U,
+		0x365E1758U, 0x379C7D6FU, 0x35DAC336U, 0x3418A901U,
+		0x3157BF84U, 0x3095D5B3U, 0x32D36BEAU, 0x331101DDU,
+		0x246BE590U, 0x25A98FA7U, 0x27EF31FEU, 0x262D5BC9U,
+		0x23624D4CU, 0x22A0277BU, 0x20E69922U, 0x2124F315U,
+		0x2A78B428U, 0x2BBADE1FU, 0x29FC6046U, 0x283E0A71U,
+		0x2D711CF4U, 0x2CB376C3U, 0x2EF5C89AU, 0x2F37A2ADU,
+		0x709A8DC0U, 0x7158E7F7U, 0x731E59AEU, 0x72DC3399U,
+		0x7793251CU, 0x76514F2BU, 0x7417F172U, 0x75D59B45U,
+		0x7E89DC78U, 0x7F4BB64FU, 0x7D0D0816U, 0x7CCF6221U,
+		0x798074A4U, 0x78421E93U, 0x7A04A0CAU, 0x7BC6CAFDU,
+		0x6CBC2EB0U, 0x6D7E4487U, 0x6F38FADEU, 0x6EFA90E9U,
+		0x6BB5866CU, 0x6A77EC5BU, 0x68315202U, 0x69F33835U,
+		0x62AF7F08U, 0x636D153FU, 0x612BAB66U, 0x60E9C151U,
+		0x65A6D7D4U, 0x6464BDE3U, 0x662203BAU, 0x67E0698DU,
+		0x48D7CB20U, 0x4915A117U, 0x4B531F4EU, 0x4A917579U,
+		0x4FDE63FCU, 0x4E1C09CBU, 0x4C5AB792U, 0x4D98DDA5U,
+		0x46C49A98U, 0x4706F0AFU, 0x45404EF6U, 0x448224C1U,
+		0x41CD3244U, 0x400F5873U, 0x4249E62AU, 0x438B8C1DU,
+		0x54F16850U, 0x55330267U, 0x5775BC3EU, 0x56B7D609U,
+		0x53F8C08CU, 0x523AAABBU, 0x507C14E2U, 0x51BE7ED5U,
+		0x5AE239E8U, 0x5B2053DFU, 0x5966ED86U, 0x58A487B1U,
+		0x5DEB9134U, 0x5C29FB03U, 0x5E6F455AU, 0x5FAD2F6DU,
+		0xE1351B80U, 0xE0F771B7U, 0xE2B1CFEEU, 0xE373A5D9U,
+		0xE63CB35CU, 0xE7FED96BU, 0xE5B86732U, 0xE47A0D05U,
+		0xEF264A38U, 0xEEE4200FU, 0xECA29E56U, 0xED60F461U,
+		0xE82FE2E4U, 0xE9ED88D3U, 0xEBAB368AU, 0xEA695CBDU,
+		0xFD13B8F0U, 0xFCD1D2C7U, 0xFE976C9EU, 0xFF5506A9U,
+		0xFA1A102CU, 0xFBD87A1BU, 0xF99EC442U, 0xF85CAE75U,
+		0xF300E948U, 0xF2C2837FU, 0xF0843D26U, 0xF1465711U,
+		0xF4094194U, 0xF5CB2BA3U, 0xF78D95FAU, 0xF64FFFCDU,
+		0xD9785D60U, 0xD8BA3757U, 0xDAFC890EU, 0xDB3EE339U,
+		0xDE71F5BCU, 0xDFB39F8BU, 0xDDF521D2U, 0xDC374BE5U,
+		0xD76B0CD8U, 0xD6A966EFU, 0xD4EFD8B6U, 0xD52DB281U,
+		0xD062A404U, 0xD1A0CE33U, 0xD3E6706AU, 0xD2241A5DU,
+		0xC55EFE10U, 0xC49C9427U, 0xC6DA2A7EU, 0xC7184049U,
+		0xC25756CCU, 0xC3953CFBU, 0xC1D382A2U, 0xC011E895U,
+		0xCB4DAFA8U, 0xCA8FC59FU, 0xC8C97BC6U, 0xC90B11F1U,
+		0xCC440774U, 0xCD866D43U, 0xCFC0D31AU, 0xCE02B92DU,
+		0x91AF9640U, 0x906DFC77U, 0x922B422EU, 0x93E92819U,
+		0x96A63E9CU, 0x976454ABU, 0x9522EAF2U, 0x94E080C5U,
+		0x9FBCC7F8U, 0x9E7EADCFU, 0x9C381396U, 0x9DFA79A1U,
+		0x98B56F24U, 0x99770513U, 0x9B31BB4AU, 0x9AF3D17DU,
+		0x8D893530U, 0x8C4B5F07U, 0x8E0DE15EU, 0x8FCF8B69U,
+		0x8A809DECU, 0x8B42F7DBU, 0x89044982U, 0x88C623B5U,
+		0x839A6488U, 0x82580EBFU, 0x801EB0E6U, 0x81DCDAD1U,
+		0x8493CC54U, 0x8551A663U, 0x8717183AU, 0x86D5720DU,
+		0xA9E2D0A0U, 0xA820BA97U, 0xAA6604CEU, 0xABA46EF9U,
+		0xAEEB787CU, 0xAF29124BU, 0xAD6FAC12U, 0xACADC625U,
+		0xA7F18118U, 0xA633EB2FU, 0xA4755576U, 0xA5B73F41U,
+		0xA0F829C4U, 0xA13A43F3U, 0xA37CFDAAU, 0xA2BE979DU,
+		0xB5C473D0U, 0xB40619E7U, 0xB640A7BEU, 0xB782CD89U,
+		0xB2CDDB0CU, 0xB30FB13BU, 0xB1490F62U, 0xB08B6555U,
+		0xBBD72268U, 0xBA15485FU, 0xB853F606U, 0xB9919C31U,
+		0xBCDE8AB4U, 0xBD1CE083U, 0xBF5A5EDAU, 0xBE9834EDU,
+	},
+	{
+		0x00000000U, 0xB8BC6765U, 0xAA09C88BU, 0x12B5AFEEU,
+		0x8F629757U, 0x37DEF032U, 0x256B5FDCU, 0x9DD738B9U,
+		0xC5B428EFU, 0x7D084F8AU, 0x6FBDE064U, 0xD7018701U,
+		0x4AD6BFB8U, 0xF26AD8DDU, 0xE0DF7733U, 0x58631056U,
+		0x5019579FU, 0xE8A530FAU, 0xFA109F14U, 0x42ACF871U,
+		0xDF7BC0C8U, 0x67C7A7ADU, 0x75720843U, 0xCDCE6F26U,
+		0x95AD7F70U, 0x2D111815U, 0x3FA4B7FBU, 0x8718D09EU,
+		0x1ACFE827U, 0xA2738F42U, 0xB0C620ACU, 0x087A47C9U,
+		0xA032AF3EU, 0x188EC85BU, 0x0A3B67B5U, 0xB28700D0U,
+		0x2F503869U, 0x97EC5F0CU, 0x8559F0E2U, 0x3DE59787U,
+		0x658687D1U, 0xDD3AE0B4U, 0xCF8F4F5AU, 0x7733283FU,
+		0xEAE41086U, 0x525877E3U, 0x40EDD80DU, 0xF851BF68U,
+		0xF02BF8A1U, 0x48979FC4U, 0x5A22302AU, 0xE29E574FU,
+		0x7F496FF6U, 0xC7F50893U, 0xD540A77DU, 0x6DFCC018U,
+		0x359FD04EU, 0x8D23B72BU, 0x9F9618C5U, 0x272A7FA0U,
+		0xBAFD4719U, 0x0241207CU, 0x10F48F92U, 0xA848E8F7U,
+		0x9B14583DU, 0x23A83F58U, 0x311D90B6U, 0x89A1F7D3U,
+		0x1476CF6AU, 0xACCAA80FU, 0xBE7F07E1U, 0x06C36084U,
+		0x5EA070D2U, 0xE61C17B7U, 0xF4A9B859U, 0x4C15DF3CU,
+		0xD1C2E785U, 0x697E80E0U, 0x7BCB2F0EU, 0xC377486BU,
+		0xCB0D0FA2U, 0x73B168C7U, 0x6104C729U, 0xD9B8A04CU,
+		0x446F98F5U, 0xFCD3FF90U, 0xEE66507EU, 0x56DA371BU,
+		0x0EB9274DU, 0xB6054028U, 0xA4B0EFC6U, 0x1C0C88A3U,
+		0x81DBB01AU, 0x3967D77FU, 0x2BD27891U, 0x936E1FF4U,
+		0x3B26F703U, 0x839A9066U, 0x912F3F88U, 0x299358EDU,
+		0xB4446054U, 0x0CF80731U, 0x1E4DA8DFU, 0xA6F1CFBAU,
+		0xFE92DFECU, 0x462EB889U, 0x549B1767U, 0xEC277002U,
+		0x71F048BBU, 0xC94C2FDEU, 0xDBF98030U, 0x6345E755U,
+		0x6B3FA09CU, 0xD383C7F9U, 0xC1366817U, 0x798A0F72U,
+		0xE45D37CBU, 0x5CE150AEU, 0x4E54FF40U, 0xF6E89825U,
+		0xAE8B8873U, 0x1637EF16U, 0x048240F8U, 0xBC3E279DU,
+		0x21E91F24U, 0x99557841U, 0x8BE0D7AFU, 0x335CB0CAU,
+		0xED59B63BU, 0x55E5D15EU, 0x47507EB0U, 0xFFEC19D5U,
+		0x623B216CU, 0xDA874609U, 0xC832E9E7U, 0x708E8E82U,
+		0x28ED9ED4U, 0x9051F9B1U, 0x82E4565FU, 0x3A58313AU,
+		0xA78F0983U, 0x1F336EE6U, 0x0D86C108U, 0xB53AA66DU,
+		0xBD40E1A4U, 0x05FC86C1U, 0x1749292FU, 0xAFF54E4AU,
+		0x322276F3U, 0x8A9E1196U, 0x982BBE78U, 0x2097D91DU,
+		0x78F4C94BU, 0xC048AE2EU, 0xD2FD01C0U, 0x6A4166A5U,
+		0xF7965E1CU, 0x4F2A3979U, 0x5D9F9697U, 0xE523F1F2U,
+		0x4D6B1905U, 0xF5D77E60U, 0xE762D18EU, 0x5FDEB6EBU,
+		0xC2098E52U, 0x7AB5E937U, 0x680046D9U, 0xD0BC21BCU,
+		0x88DF31EAU, 0x3063568FU, 0x22D6F961U, 0x9A6A9E04U,
+		0x07BDA6BDU, 0xBF01C1D8U, 0xADB46E36U, 0x15080953U,
+		0x1D724E9AU, 0xA5CE29FFU, 0xB77B8611U, 0x0FC7E174U,
+		0x9210D9CDU, 0x2AACBEA8U, 0x38191146U, 0x80A57623U,
+		0xD8C66675U, 0x607A0110U, 0x72CFAEFEU, 0xCA73C99BU,
+		0x57A4F122U, 0xEF189647U, 0xFDAD39A9U, 0x45115ECCU,
+		0x764DEE06U, 0xCEF18963U, 0xDC44268DU, 0x64F841E8U,
+		0xF92F7951U, 0x41931E34U, 0x5326B1DAU, 0xEB9AD6BFU,
+		0xB3F9C6E9U, 0x0B45A18CU, 0x19F00E62U, 0xA14C6907U,
+		0x3C9B51BEU, 0x842736DBU, 0x96929935U, 0x2E2EFE50U,
+		0x2654B999U, 0x9EE8DEFCU, 0x8C5D7112U, 0x34E11677U,
+		0xA9362ECEU, 0x118A49ABU, 0x033FE645U, 0xBB838120U,
+		0xE3E09176U, 0x5B5CF613U, 0x49E959FDU, 0xF1553E98U,
+		0x6C820621U, 0xD43E6144U, 0xC68BCEAAU, 0x7E37A9CFU,
+		0xD67F4138U, 0x6EC3265DU, 0x7C7689B3U, 0xC4CAEED6U,
+		0x591DD66FU, 0xE1A1B10AU, 0xF3141EE4U, 0x4BA87981U,
+		0x13CB69D7U, 0xAB770EB2U, 0xB9C2A15CU, 0x017EC639U,
+		0x9CA9FE80U, 0x241599E5U, 0x36A0360BU, 0x8E1C516EU,
+		0x866616A7U, 0x3EDA71C2U, 0x2C6FDE2CU, 0x94D3B949U,
+		0x090481F0U, 0xB1B8E695U, 0xA30D497BU, 0x1BB12E1EU,
+		0x43D23E48U, 0xFB6E592DU, 0xE9DBF6C3U, 0x516791A6U,
+		0xCCB0A91FU, 0x740CCE7AU, 0x66B96194U, 0xDE0506F1U,
+	},
+#endif /* CONFIG_CRC32_SLICES >= 4 */
+#if CONFIG_CRC32_SLICES >= 8
+	{
+		0x00000000U, 0x3D6029B0U, 0x7AC05360U, 0x47A07AD0U,
+		0xF580A6C0U, 0xC8E08F70U, 0x8F40F5A0U, 0xB220DC10U,
+		0x30704BC1U, 0x0D106271U, 0x4AB018A1U, 0x77D03111U,
+		0xC5F0ED01U, 0xF890C4B1U, 0xBF30BE61U, 0x825097D1U,
+		0x60E09782U, 0x5D80BE32U, 0x1A20C4E2U, 0x2740ED52U,
+		0x95603142U, 0xA80018F2U, 0xEFA06222U, 0xD2C04B92U,
+		0x5090DC43U, 0x6DF0F5F3U, 0x2A508F23U, 0x1730A693U,
+		0xA5107A83U, 0x98705333U, 0xDFD029E3U, 0xE2B00053U,
+		0xC1C12F04U, 0xFCA106B4U, 0xBB017C64U, 0x866155D4U,
+		0x344189C4U, 0x0921A074U, 0x4E81DAA4U, 0x73E1F314U,
+		0xF1B164C5U, 0xCCD14D75U, 0x8B7137A5U, 0xB6111E15U,
+		0x0431C205U, 0x3951EBB5U, 0x7EF19165U, 0x4391B8D5U,
+		0xA121B886U, 0x9C419136U, 0xDBE1EBE6U, 0xE681C256U,
+		0x54A11E46U, 0x69C137F6U, 0x2E614D26U, 0x13016496U,
+		0x9151F347U, 0xAC31DAF7U, 0xEB91A027U, 0xD6F18997U,
+		0x64D15587U, 0x59B17C37U, 0x1E1106E7U, 0x23712F57U,
+		0x58F35849U, 0x659371F9U, 0x22330B29U, 0x1F532299U,
+		0xAD73FE89U, 0x9013D739U, 0xD7B3ADE9U, 0xEAD38459U,
+		0x68831388U, 0x55E33A38U, 0x124340E8U, 0x2F236958U,
+		0x9D03B548U, 0xA0639CF8U, 0xE7C3E628U, 0xDAA3CF98U,
+		0x3813CFCBU, 0x0573E67BU, 0x42D39CABU, 0x7FB3B51BU,
+		0xCD93690BU, 0xF0F340BBU, 0xB7533A6BU, 0x8A3313DBU,
+		0x0863840AU, 0x3503ADBAU, 0x72A3D76AU, 0x4FC3FEDAU,
+		0xFDE322CAU, 0xC0830B7AU, 0x872371AAU, 0xBA43581AU,
+		0x9932774DU, 0xA4525EFDU, 0xE3F2242DU, 0xDE920D9DU,
+		0x6CB2D18DU, 0x51D2F83DU, 0x167282EDU, 0x2B12AB5DU,
+		0xA9423C8CU, 0x9422153CU, 0xD3826FECU, 0xEEE2465CU,
+		0x5CC29A4CU, 0x61A2B3FCU, 0x2602C92CU, 0x1B62E09CU,
+		0xF9D2E0CFU, 0xC4B2C97FU, 0x8312B3AFU, 0xBE729A1FU,
+		0x0C52460FU, 0x31326FBFU, 0x7692156FU, 0x4BF23CDFU,
+		0xC9A2AB0EU, 0xF4C282BEU, 0xB362F86EU, 0x8E02D1DEU,
+		0x3C220DCEU, 0x0142247EU, 0x46E25EAEU, 0x7B82771EU,
+		0xB1E6B092U, 0x8C869922U, 0xCB26E3F2U, 0xF646CA42U,
+		0x44661652U, 0x79063FE2U, 0x3EA64532U, 0x03C66C82U,
+		0x8196FB53U, 0xBCF6D2E3U, 0xFB56A833U, 0xC6368183U,
+		0x74165D93U, 0x49767423U, 0x0ED60EF3U, 0x33B62743U,
+		0xD1062710U, 0xEC660EA0U, 0xABC67470U, 0x96A65DC0U,
+		0x248681D0U, 0x19E6A860U, 0x5E46D2B0U, 0x6326FB00U,
+		0xE1766CD1U, 0xDC164561U, 0x9BB63FB1U, 0xA6D61601U,
+		0x14F6CA11U, 0x2996E3A1U, 0x6E369971U, 0x5356B0C1U,
+		0x70279F96U, 0x4D47B626U, 0x0AE7CCF6U, 0x3787E546U,
+		0x85A73956U, 0xB8C710E6U, 0xFF676A36U, 0xC2074386U,
+		0x4057D457U, 0x7D37FDE7U, 0x3A978737U, 0x07F7AE87U,
+		0xB5D77297U, 0x88B75B27U, 0xCF1721F7U, 0xF2770847U,
+		0x10C70814U, 0x2DA721A4U, 0x6A075B74U, 0x576772C4U,
+		0xE547AED4U, 0xD8278764U, 0x9F87FDB4U, 0xA2E7D404U,
+		0x20B743D5U, 0x1DD76A65U, 0x5A7710B5U, 0x67173905U,
+		0xD537E515U, 0xE857CCA5U, 0xAFF7B675U, 0x92979FC5U,
+		0xE915E8DBU, 0xD475C16BU, 0x93D5BBBBU, 0xAEB5920BU,
+		0x1C954E1BU, 0x21F567ABU, 0x66551D7BU, 0x5B3534CBU,
+		0xD965A31AU, 0xE4058AAAU, 0xA3A5F07AU, 0x9EC5D9CAU,
+		0x2CE505DAU, 0x11852C6AU, 0x562556BAU, 0x6B457F0AU,
+		0x89F57F59U, 0xB49556E9U, 0xF3352C39U, 0xCE550589U,
+		0x7C75D999U, 0x4115F029U, 0x06B58AF9U, 0x3BD5A349U,
+		0xB9853498U, 0x84E51D28U, 0xC34567F8U, 0xFE254E48U,
+		0x4C059258U, 0x7165BBE8U, 0x36C5C138U, 0x0BA5E888U,
+		0x28D4C7DFU, 0x15B4EE6FU, 0x521494BFU, 0x6F74BD0FU,
+		0xDD54611FU, 0xE03448AFU, 0xA794327FU, 0x9AF41BCFU,
+		0x18A48C1EU, 0x25C4A5AEU, 0x6264DF7EU, 0x5F04F6CEU,
+		0xED242ADEU, 0xD044036EU, 0x97E479BEU, 0xAA84500EU,
+		0x4834505DU, 0x755479EDU, 0x32F4033DU, 0x0F942A8DU,
+		0xBDB4F69DU, 0x80D4DF2DU, 0xC774A5FDU, 0xFA148C4DU,
+		0x78441B9CU, 0x4524322CU, 0x028448FCU, 0x3FE4614CU,
+		0x8DC4BD5CU, 0xB0A494ECU, 0xF704EE3CU, 0xCA64C78CU,
+	},
+	{
+		0x00000000U, 0xCB5CD3A5U, 0x4DC8A10BU, 0x869472AEU,
+		0x9B914216U, 0x50CD91B3U, 0xD659E31DU, 0x1D0530B8U,
+		0xEC53826DU, 0x270F51C8U, 0xA19B2366U, 0x6AC7F0C3U,
+		0x77C2C07BU, 0xBC9E13DEU, 0x3A0A6170U, 0xF156B2D5U,
+		0x03D6029BU, 0xC88AD13EU, 0x4E1EA390U, 0x85427035U,
+		0x9847408DU, 0x531B9328U, 0xD58FE186U, 0x1ED33223U,
+		0xEF8580F6U, 0x24D95353U, 0xA24D21FDU, 0x6911F258U,
+		0x7414C2E0U, 0xBF481145U, 0x39DC63EBU, 0xF280B04EU,
+		0x07AC0536U, 0xCCF0D693U, 0x4A64A43DU, 0x81387798U,
+		0x9C3D4720U, 0x57619485U, 0xD1F5E62BU, 0x1AA9358EU,
+		0xEBFF875BU, 0x20A354FEU, 0xA6372650U, 0x6D6BF5F5U,
+		0x706EC54DU, 0xBB3216E8U, 0x3DA66446U, 0xF6FAB7E3U,
+		0x047A07ADU, 0xCF26D408U, 0x49B2A6A6U, 0x82EE7503U,
+		0x9FEB45BBU, 0x54B7961EU, 0xD223E4B0U, 0x197F3715U,
+		0xE82985C0U, 0x23755665U, 0xA5E124CBU, 0x6EBDF76EU,
+		0x73B8C7D6U, 0xB8E41473U, 0x3E7066DDU, 0xF52CB578U,
+		0x0F580A6CU, 0xC404D9C9U, 0x4290AB67U, 0x89CC78C2U,
+		0x94C9487AU, 0x5F959BDFU, 0xD901E971U, 0x125D3AD4U,
+		0xE30B8801U, 0x28575BA4U, 0xAEC3290AU, 0x659FFAAFU,
+		0x789ACA17U, 0xB3C619B2U, 0x35526B1CU, 0xFE0EB8B9U,
+		0x0C8E08F7U, 0xC7D2DB52U, 0x4146A9FCU, 0x8A1A7A59U,
+		0x971F4AE1U, 0x5C439944U, 0xDAD7EBEAU, 0x118B384FU,
+		0xE0DD8A9AU, 0x2B81593FU, 0xAD152B91U, 0x6649F834U,
+		0x7B4CC88CU, 0xB0101B29U, 0x36846987U, 0xFDD8BA22U,
+		0x08F40F5AU, 0xC3A8DCFFU, 0x453CAE51U, 0x8E607DF4U,
+		0x93654D4CU, 0x58399EE9U, 0xDEADEC47U, 0x15F13FE2U,
+		0xE4A78D37U, 0x2FFB5E92U, 0xA96F2C3CU, 0x6233FF99U,
+		0x7F36CF21U, 0xB46A1C84U, 0x32FE6E2AU, 0xF9A2BD8FU,
+		0x0B220DC1U, 0xC07EDE64U, 0x46EAACCAU, 0x8DB67F6FU,
+		0x90B34FD7U, 0x5BEF9C72U, 0xDD7BEEDCU, 0x16273D79U,
+		0xE7718FACU, 0x2C2D5C09U, 0xAAB92EA7U, 0x61E5FD02U,
+		0x7CE0CDBAU, 0xB7BC1E1FU, 0x31286CB1U, 0xFA74BF14U,
+		0x1EB014D8U, 0xD5ECC77DU, 0x5378B5D3U, 0x98246676U,
+		0x852156CEU, 0x4E7D856BU, 0xC8E9F7C5U, 0x03B52460U,
+		0xF2E396B5U, 0x39BF4510U, 0xBF2B37BEU, 0x7477E41BU,
+		0x6972D4A3U, 0xA22E0706U, 0x24BA75A8U, 0xEFE6A60DU,
+		0x1D661643U, 0xD63AC5E6U, 0x50AEB748U, 0x9BF264EDU,
+		0x86F75455U, 0x4DAB87F0U, 0xCB3FF55EU, 0x006326FBU,
+		0xF135942EU, 0x3A69478BU, 0xBCFD3525U, 0x77A1E680U,
+		0x6AA4D638U, 0xA1F8059DU, 0x276C7733U, 0xEC30A496U,
+		0x191C11EEU, 0xD240C24BU, 0x54D4B0E5U, 0x9F886340U,
+		0x828D53F8U, 0x49D1805DU, 0xCF45F2F3U, 0x04192156U,
+		0xF54F9383U, 0x3E134026U, 0xB8873288U, 0x73DBE12DU,
+		0x6EDED195U, 0xA5820230U, 0x2316709EU, 0xE84AA33BU,
+		0x1ACA1375U, 0xD196C0D0U, 0x5702B27EU, 0x9C5E61DBU,
+		0x815B5163U, 0x4A0782C6U, 0xCC93F068U, 0x07CF23CDU,
+		0xF6999118U, 0x3DC542BDU, 0xBB513013U, 0x700DE3B6U,
+		0x6D08D30EU, 0xA65400ABU, 0x20C07205U, 0xEB9CA1A0U,
+		0x11E81EB4U, 0xDAB4CD11U, 0x5C20BFBFU, 0x977C6C1AU,
+		0x8A795CA2U, 0x41258F07U, 0xC7B1FDA9U, 0x0CED2E0CU,
+		0xFDBB9CD9U, 0x36E74F7CU, 0xB0733DD2U, 0x7B2FEE77U,
+		0x662ADECFU, 0xAD760D6AU, 0x2BE27FC4U, 0xE0BEAC61U,
+		0x123E1C2FU, 0xD962CF8AU, 0x5FF6BD24U, 0x94AA6E81U,
+		0x89AF5E39U, 0x42F38D9CU, 0xC467FF32U, 0x0F3B2C97U,
+		0xFE6D9E42U, 0x35314DE7U, 0xB3A53F49U, 0x78F9ECECU,
+		0x65FCDC54U, 0xAEA00FF1U, 0x28347D5FU, 0xE368AEFAU,
+		0x16441B82U, 0xDD18C827U, 0x5B8CBA89U, 0x90D0692CU,
+		0x8DD55994U, 0x46898A31U, 0xC01DF89FU, 0x0B412B3AU,
+		0xFA1799EFU, 0x314B4A4AU, 0xB7DF38E4U, 0x7C83EB41U,
+		0x6186DBF9U, 0xAADA085CU, 0x2C4E7AF2U, 0xE712A957U,
+		0x15921919U, 0xDECECABCU, 0x585AB812U, 0x93066BB7U,
+		0x8E035B0FU, 0x455F88AAU, 0xC3CBFA04U, 0x089729A1U,
+		0xF9C19B74U, 0x329D48D1U, 0xB4093A7FU, 0x7F55E9DAU,
+		0x6250D962U, 0xA90C0AC7U, 0x2F987869U, 0xE4C4ABCCU,
+	},
+	{
+		0x00000000U, 0xA6770BB4U, 0x979F1129U, 0x31E81A9DU,
+		0xF44F2413U, 0x52382FA7U, 0x63D0353AU, 0xC5A73E8EU,
+		0x33EF4E67U, 0x959845D3U, 0xA4705F4EU, 0x020754FAU,
+		0xC7A06A74U, 0x61D761C0U, 0x503F7B5DU, 0xF64870E9U,
+		0x67DE9CCEU, 0xC1A9977AU, 0xF0418DE7U, 0x56368653U,
+		0x9391B8DDU, 0x35E6B369U, 0x040EA9F4U, 0xA279A240U,
+		0x5431D2A9U, 0xF246D91DU, 0xC3AEC380U, 0x65D9C834U,
+		0xA07EF6BAU, 0x0609FD0EU, 0x37E1E793U, 0x9196EC27U,
+		0xCFBD399CU, 0x69CA3228U, 0x582228B5U, 0xFE552301U,
+		0x3BF21D8FU, 0x9D85163BU, 0xAC6D0CA6U, 0x0A1A0712U,
+		0xFC5277FBU, 0x5A257C4FU, 0x6BCD66D2U, 0xCDBA6D66U,
+		0x081D53E8U, 0xAE6A585CU, 0x9F8242C1U, 0x39F54975U,
+		0xA863A552U, 0x0E14AEE6U, 0x3FFCB47BU, 0x998BBFCFU,
+		0x5C2C8141U, 0xFA5B8AF5U, 0xCBB39068U, 0x6DC49BDCU,
+		0x9B8CEB35U, 0x3DFBE081U, 0x0C13FA1CU, 0xAA64F1A8U,
+		0x6FC3CF26U, 0xC9B4C492U, 0xF85CDE0FU, 0x5E2BD5BBU,
+		0x440B7579U, 0xE27C7ECDU, 0xD3946450U, 0x75E36FE4U,
+		0xB044516AU, 0x16335ADEU, 0x27DB4043U, 0x81AC4BF7U,
+		0x77E43B1EU, 0xD19330AAU, 0xE07B2A37U, 0x460C2183U,
+		0x83AB1F0DU, 0x25DC14B9U, 0x14340E24U, 0xB2430590U,
+		0x23D5E9B7U, 0x85A2E203U, 0xB44AF89EU, 0x123DF32AU,
+		0xD79ACDA4U, 0x71EDC610U, 0x4005DC8DU, 0xE672D739U,
+		0x103AA7D0U, 0xB64DAC64U, 0x87A5B6F9U, 0x21D2BD4DU,
+		0xE47583C3U, 0x42028877U, 0x73EA92EAU, 0xD59D995EU,
+		0x8BB64CE5U, 0x2DC14751U, 0x1C295DCCU, 0xBA5E5678U,
+		0x7FF968F6U, 0xD98E6342U, 0xE86679DFU, 0x4E11726BU,
+		0xB8590282U, 0x1E2E0936U, 0x2FC613ABU, 0x89B1181FU,
+		0x4C162691U, 0xEA612D25U, 0xDB8937B8U, 0x7DFE3C0CU,
+		0xEC68D02BU, 0x4A1FDB9FU, 0x7BF7C102U, 0xDD80CAB6U,
+		0x1827F438U, 0xBE50FF8CU, 0x8FB8E511U, 0x29CFEEA5U,
+		0xDF879E4CU, 0x79F095F8U, 0x48188F65U, 0xEE6F84D1U,
+		0x2BC8BA5FU, 0x8DBFB1EBU, 0xBC57AB76U, 0x1A20A0C2U,
+		0x8816EAF2U, 0x2E61E146U, 0x1F89FBDBU, 0xB9FEF06FU,
+		0x7C59CEE1U, 0xDA2EC555U, 0xEBC6DFC8U, 0x4DB1D47CU,
+		0xBBF9A495U, 0x1D8EAF21U, 0x2C66B5BCU, 0x8A11BE08U,
+		0x4FB68086U, 0xE9C18B32U, 0xD82991AFU, 0x7E5E9A1BU,
+		0xEFC8763CU, 0x49BF7D88U, 0x78576715U, 0xDE206CA1U,
+		0x1B87522FU, 0xBDF0599BU, 0x8C184306U, 0x2A6F48B2U,
+		0xDC27385BU, 0x7A5033EFU, 0x4BB82972U, 0xEDCF22C6U,
+		0x28681C48U, 0x8E1F17FCU, 0xBFF70D61U, 0x198006D5U,
+		0x47ABD36EU, 0xE1DCD8DAU, 0xD034C247U, 0x7643C9F3U,
+		0xB3E4F77DU, 0x1593FCC9U, 0x247BE654U, 0x820CEDE0U,
+		0x74449D09U, 0xD23396BDU, 0xE3DB8C20U, 0x45AC8794U,
+		0x800BB91AU, 0x267CB2AEU, 0x1794A833U, 0xB1E3A387U,
+		0x20754FA0U, 0x86024414U, 0xB7EA5E89U, 0x119D553DU,
+		0xD43A6BB3U, 0x724D6007U, 0x43A57A9AU, 0xE5D2712EU,
+		0x139A01C7U, 0xB5ED0A73U, 0x840510EEU, 0x22721B5AU,
+		0xE7D525D4U, 0x41A22E60U, 0x704A34FDU, 0xD63D3F49U,
+		0xCC1D9F8BU, 0x6A6A943FU, 0x5B828EA2U, 0xFDF58516U,
+		0x3852BB98U, 0x9E25B02CU, 0xAFCDAAB1U, 0x09BAA105U,
+		0xFFF2D1ECU, 0x5985DA58U, 0x686DC0C5U, 0xCE1ACB71U,
+		0x0BBDF5FFU, 0xADCAFE4BU, 0x9C22E4D6U, 0x3A55EF62U,
+		0xABC30345U, 0x0DB408F1U, 0x3C5C126CU, 0x9A2B19D8U,
+		0x5F8C2756U, 0xF9FB2CE2U, 0xC813367FU, 0x6E643DCBU,
+		0x982C4D22U, 0x3E5B4696U, 0x0FB35C0BU, 0xA9C457BFU,
+		0x6C636931U, 0xCA146285U, 0xFBFC7818U, 0x5D8B73ACU,
+		0x03A0A617U, 0xA5D7ADA3U, 0x943FB73EU, 0x3248BC8AU,
+		0xF7EF8204U, 0x519889B0U, 0x6070932DU, 0xC6079899U,
+		0x304FE870U, 0x9638E3C4U, 0xA7D0F959U, 0x01A7F2EDU,
+		0xC400CC63U, 0x6277C7D7U, 0x539FDD4AU, 0xF5E8D6FEU,
+		0x647E3AD9U, 0xC209316DU, 0xF3E12BF0U, 0x55962044U,
+		0x90311ECAU, 0x3646157EU, 0x07AE0FE3U, 0xA1D90457U,
+		0x579174BEU, 0xF1E67F0AU, 0xC00E6597U, 0x66796E23U,
+		0xA3DE50ADU, 0x05A95B19U, 0x34414184U, 0x92364A30U,
+	},
+	{
+		0x00000000U, 0xCCAA009EU, 0x4225077DU, 0x8E8F07E3U,
+		0x844A0EFAU, 0x48E00E64U, 0xC66F0987U, 0x0AC50919U,
+		0xD3E51BB5U, 0x1F4F1B2BU, 0x91C01CC8U, 0x5D6A1C56U,
+		0x57AF154FU, 0x9B0515D1U, 0x158A1232U, 0xD92012ACU,
+		0x7CBB312BU, 0xB01131B5U, 0x3E9E3656U, 0xF23436C8U,
+		0xF8F13FD1U, 0x345B3F4FU, 0xBAD438ACU, 0x767E3832U,
+		0xAF5E2A9EU, 0x63F42A00U, 0xED7B2DE3U, 0x21D12D7DU,
+		0x2B142464U, 0xE7BE24FAU, 0x69312319U, 0xA59B2387U,
+		0xF9766256U, 0x35DC62C8U, 0xBB53652BU, 0x77F965B5U,
+		0x7D3C6CACU, 0xB1966C32U, 0x3F196BD1U, 0xF3B36B4FU,
+		0x2A9379E3U, 0xE639797DU, 0x68B67E9EU, 0xA41C7E00U,
+		0xAED97719U, 0x62737787U, 0xECFC7064U, 0x205670FAU,
+		0x85CD537DU, 0x496753E3U, 0xC7E85400U, 0x0B42549EU,
+		0x01875D87U, 0xCD2D5D19U, 0x43A25AFAU, 0x8F085A64U,
+		0x562848C8U, 0x9A824856U, 0x140D4FB5U, 0xD8A74F2BU,
+		0xD2624632U, 0x1EC846ACU, 0x9047414FU, 0x5CED41D1U,
+		0x299DC2EDU, 0xE537C273U, 0x6BB8C590U, 0xA712C50EU,
+		0xADD7CC17U, 0x617DCC89U, 0xEFF2CB6AU, 0x2358CBF4U,
+		0xFA78D958U, 0x36D2D9C6U, 0xB85DDE25U, 0x74F7DEBBU,
+		0x7E32D7A2U, 0xB298D73CU, 0x3C17D0DFU, 0xF0BDD041U,
+		0x5526F3C6U, 0x998CF358U, 0x1703F4BBU, 0xDBA9F425U,
+		0xD16CFD3CU, 0x1DC6FDA2U, 0x9349FA41U, 0x5FE3FADFU,
+		0x86C3E873U, 0x4A69E8EDU, 0xC4E6EF0EU, 0x084CEF90U,
+		0x0289E689U, 0xCE23E617U, 0x40ACE1F4U, 0x8C06E16AU,
+		0xD0EBA0BBU, 0x1C41A025U, 0x92CEA7C6U, 0x5E64A758U,
+		0x54A1AE41U, 0x980BAEDFU, 0x1684A93CU, 0xDA2EA9A2U,
+		0x030EBB0EU, 0xCFA4BB90U, 0x412BBC73U, 0x8D81BCEDU,
+		0x8744B5F4U, 0x4BEEB56AU, 0xC561B289U, 0x09CBB217U,
+		0xAC509190U, 0x60FA910EU, 0xEE7596EDU, 0x22DF9673U,
+		0x281A9F6AU, 0xE4B09FF4U, 0x6A3F9817U, 0xA6959889U,
+		0x7FB58A25U, 0xB31F8ABBU, 0x3D908D58U, 0xF13A8DC6U,
+		0xFBFF84DFU, 0x37558441U, 0xB9DA83A2U, 0x7570833CU,
+		0x533B85DAU, 0x9F918544U, 0x111E82A7U, 0xDDB48239U,
+		0xD7718B20U, 0x1BDB8BBEU, 0x95548C5DU, 0x59FE8CC3U,
+		0x80DE9E6FU, 0x4C749EF1U, 0xC2FB9912U, 0x0E51998CU,
+		0x04949095U, 0xC83E900BU, 0x46B197E8U, 0x8A1B9776U,
+		0x2F80B4F1U, 0xE32AB46FU, 0x6DA5B38CU, 0xA10FB312U,
+		0xABCABA0BU, 0x6760BA95U, 0xE9EFBD76U, 0x2545BDE8U,
+		0xFC65AF44U, 0x30CFAFDAU, 0xBE40A839U, 0x72EAA8A7U,
+		0x782FA1BEU, 0xB485A120U, 0x3A0AA6C3U, 0xF6A0A65DU,
+		0xAA4DE78CU, 0x66E7E712U, 0xE868E0F1U, 0x24C2E06FU,
+		0x2E07E976U, 0xE2ADE9E8U, 0x6C22EE0BU, 0xA088EE95U,
+		0x79A8FC39U, 0xB502FCA7U, 0x3B8DFB44U, 0xF727FBDAU,
+		0xFDE2F2C3U, 0x3148F25DU, 0xBFC7F5BEU, 0x736DF520U,
+		0xD6F6D6A7U, 0x1A5CD639U, 0x94D3D1DAU, 0x5879D144U,
+		0x52BCD85DU, 0x9E16D8C3U, 0x1099DF20U, 0xDC33DFBEU,
+		0x0513CD12U, 0xC9B9CD8CU, 0x4736CA6FU, 0x8B9CCAF1U,
+		0x8159C3E8U, 0x4DF3C376U, 0xC37CC495U, 0x0FD6C40BU,
+		0x7AA64737U, 0xB60C47A9U, 0x3883404AU, 0xF42940D4U,
+		0xFEEC49CDU, 0x32464953U, 0xBCC94EB0U, 0x70634E2EU,
+		0xA9435C82U, 0x65E95C1CU, 0xEB665BFFU, 0x27CC5B61U,
+		0x2D095278U, 0xE1A352E6U, 0x6F2C5505U, 0xA386559BU,
+		0x061D761CU, 0xCAB77682U, 0x44387161U, 0x889271FFU,
+		0x825778E6U, 0x4EFD7878U, 0xC0727F9BU, 0x0CD87F05U,
+		0xD5F86DA9U, 0x19526D37U, 0x97DD6AD4U, 0x5B776A4AU,
+		0x51B26353U, 0x9D1863CDU, 0x1397642EU, 0xDF3D64B0U,
+		0x83D02561U, 0x4F7A25FFU, 0xC1F5221CU, 0x0D5F2282U,
+		0x079A2B9BU, 0xCB302B05U, 0x45BF2CE6U, 0x89152C78U,
+		0x50353ED4U, 0x9C9F3E4AU, 0x121039A9U, 0xDEBA3937U,
+		0xD47F302EU, 0x18D530B0U, 0x965A3753U, 0x5AF037CDU,
+		0xFF6B144AU, 0x33C114D4U, 0xBD4E1337U, 0x71E413A9U,
+		0x7B211AB0U, 0xB78B1A2EU, 0x39041DCDU, 0xF5AE1D53U,
+		0x2C8E0FFFU, 0xE0240F61U, 0x6EAB0882U, 0xA201081CU,
+		0xA8C40105U, 0x646E019BU, 0xEAE10678U, 0x264B06E6U,
+	},
+#endif /* CONFIG_CRC32_SLICES >= 8 */
+};
+
+/* CRC-32C (Castagnoli), reflected polynomial 0x82F63B78 */
+const uint32_t crc32c_table[CONFIG_CRC32_SLICES][256] = {
+	{
+		0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U,
+		0xC79A971FU, 0x35F1141CU, 0x26A1E7E8U, 0xD4CA64EBU,
+		0x8AD958CFU, 0x78B2DBCCU, 0x6BE22838U, 0x9989AB3BU,
+		0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U, 0x5E133C24U,
+		0x105EC76FU, 0xE235446CU, 0xF165B798U, 0x030E349BU,
+		0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U,
+		0x9A879FA0U, 0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U,
+		0x5D1D08BFU, 0xAF768BBCU, 0xBC267848U, 0x4E4DFB4BU,
+		0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U, 0x33ED7D2AU,
+		0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U,
+		0xAA64D611U, 0x580F5512U, 0x4B5FA6E6U, 0xB93425E5U,
+		0x6DFE410EU, 0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU,
+		0x30E349B1U, 0xC288CAB2U, 0xD1D83946U, 0x23B3BA45U,
+		0xF779DEAEU, 0x05125DADU, 0x1642AE59U, 0xE4292D5AU,
+		0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU,
+		0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U,
+		0x417B1DBCU, 0xB3109EBFU, 0xA0406D4BU, 0x522BEE48U,
+		0x86E18AA3U, 0x748A09A0U, 0x67DAFA54U, 0x95B17957U,
+		0xCBA24573U, 0x39C9C670U, 0x2A993584U, 0xD8F2B687U,
+		0x0C38D26CU, 0xFE53516FU, 0xED03A29BU, 0x1F682198U,
+		0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U,
+		0x96BF4DCCU, 0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U,
+		0xDBFC821CU, 0x2997011FU, 0x3AC7F2EBU, 0xC8AC71E8U,
+		0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U, 0x0F36E6F7U,
+		0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U,
+		0xA65C047DU, 0x5437877EU, 0x4767748AU, 0xB50CF789U,
+		0xEB1FCBADU, 0x197448AEU, 0x0A24BB5AU, 0xF84F3859U,
+		0x2C855CB2U, 0xDEEEDFB1U, 0xCDBE2C45U, 0x3FD5AF46U,
+		0x7198540DU, 0x83F3D70EU, 0x90A324FAU, 0x62C8A7F9U,
+		0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+		0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U,
+		0x3CDB9BDDU, 0xCEB018DEU, 0xDDE0EB2AU, 0x2F8B6829U,
+		0x82F63B78U, 0x709DB87BU, 0x63CD4B8FU, 0x91A6C88CU,
+		0x456CAC67U, 0xB7072F64U, 0xA457DC90U, 0x563C5F93U,
+		0x082F63B7U, 0xFA44E0B4U, 0xE9141340U, 0x1B7F9043U,
+		0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU,
+		0x92A8FC17U, 0x60C37F14U, 0x73938CE0U, 0x81F80FE3U,
+		0x55326B08U, 0xA759E80BU, 0xB4091BFFU, 0x466298FCU,
+		0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU, 0x0B21572CU,
+		0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U,
+		0xA24BB5A6U, 0x502036A5U, 0x4370C551U, 0xB11B4652U,
+		0x65D122B9U, 0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU,
+		0x2892ED69U, 0xDAF96E6AU, 0xC9A99D9EU, 0x3BC21E9DU,
+		0xEF087A76U, 0x1D63F975U, 0x0E330A81U, 0xFC588982U,
+		0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU,
+		0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U,
+		0x38CC2A06U, 0xCAA7A905U, 0xD9F75AF1U, 0x2B9CD9F2U,
+		0xFF56BD19U, 0x0D3D3E1AU, 0x1E6DCDEEU, 0xEC064EEDU,
+		0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U, 0xD0DDD530U,
+		0x0417B1DBU, 0xF67C32D8U, 0xE52CC12CU, 0x1747422FU,
+		0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU,
+		0x8ECEE914U, 0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U,
+		0xD3D3E1ABU, 0x21B862A8U, 0x32E8915CU, 0xC083125FU,
+		0x144976B4U, 0xE622F5B7U, 0xF5720643U, 0x07198540U,
+		0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U,
+		0x9E902E7BU, 0x6CFBAD78U, 0x7FAB5E8CU, 0x8DC0DD8FU,
+		0xE330A81AU, 0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU,
+		0x24AA3F05U, 0xD6C1BC06U, 0xC5914FF2U, 0x37FACCF1U,
+		0x69E9F0D5U, 0x9B8273D6U, 0x88D28022U, 0x7AB90321U,
+		0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+		0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U,
+		0x34F4F86AU, 0xC69F7B69U, 0xD5CF889DU, 0x27A40B9EU,
+		0x79B737BAU, 0x8BDCB4B9U, 0x988C474DU, 0x6AE7C44EU,
+		0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U, 0xAD7D5351U,
+	},
+#if CONFIG_CRC32_SLICES >= 4
+	{
+		0x00000000U, 0x13A29877U, 0x274530EEU, 0x34E7A899U,
+		0x4E8A61DCU, 0x5D28F9ABU, 0x69CF5132U, 0x7A6DC945U,
+		0x9D14C3B8U, 0x8EB65BCFU, 0xBA51F356U, 0xA9F36B21U,
+		0xD39EA264U, 0xC03C3A13U, 0xF4DB928AU, 0xE7790AFDU,
+		0x3FC5F181U, 0x2C6769F6U, 0x1880C16FU, 0x0B225918U,
+		0x714F905DU, 0x62ED082AU, 0x560AA0B3U, 0x45A838C4U,
+		0xA2D13239U, 0xB173AA4EU, 0x859402D7U, 0x96369AA0U,
+		0xEC5B53E5U, 0xFFF9CB92U, 0xCB1E630BU, 0xD8BCFB7CU,
+		0x7F8BE302U, 0x6C297B75U, 0x58CED3ECU, 0x4B6C4B9BU,
+		0x310182DEU, 0x22A31AA9U, 0x1644B230U, 0x05E62A47U,
+		0xE29F20BAU, 0xF13DB8CDU, 0xC5DA1054U, 0xD6788823U,
+		0xAC154166U, 0xBFB7D911U, 0x8B507188U, 0x98F2E9FFU,
+		0x404E1283U, 0x53EC8AF4U, 0x670B226DU, 0x74A9BA1AU,
+		0x0EC4735FU, 0x1D66EB28U, 0x298143B1U, 0x3A23DBC6U,
+		0xDD5AD13BU, 0xCEF8494CU, 0xFA1FE1D5U, 0xE9BD79A2U,
+		0x93D0B0E7U, 0x80722890U, 0xB4958009U, 0xA737187EU,
+		0xFF17C604U, 0xECB55E73U, 0xD852F6EAU, 0xCBF06E9DU,
+		0xB19DA7D8U, 0xA23F3FAFU, 0x96D89736U, 0x857A0F41U,
+		0x620305BCU, 0x71A19DCBU, 0x45463552U, 0x56E4AD25U,
+		0x2C896460U, 0x3F2BFC17U, 0x0BCC548EU, 0x186ECCF9U,
+		0xC0D23785U, 0xD370AFF2U, 0xE797076BU, 0xF4359F1CU,
+		0x8E585659U, 0x9DFACE2EU, 0xA91D66B7U, 0xBABFFEC0U,
+		0x5DC6F43DU, 0x4E646C4AU, 0x7A83C4D3U, 0x69215CA4U,
+		0x134C95E1U, 0x00EE0D96U, 0x3409A50FU, 0x27AB3D78U,
+		0x809C2506U, 0x933EBD71U, 0xA7D915E8U, 0xB47B8D9FU,
+		0xCE1644DAU, 0xDDB4DCADU, 0xE9537434U, 0xFAF1EC43U,
+		0x1D88E6BEU, 0x0E2A7EC9U, 0x3ACDD650U, 0x296F4E27U,
+		0x53028762U, 0x40A01F15U, 0x7447B78CU, 0x67E52FFBU,
+		0xBF59D487U, 0xACFB4CF0U, 0x981CE469U, 0x8BBE7C1EU,
+		0xF1D3B55BU, 0xE2712D2CU, 0xD69685B5U, 0xC5341DC2U,
+		0x224D173FU, 0x31EF8F48U, 0x050827D1U, 0x16AABFA6U,
+		0x6CC776E3U, 0x7F65EE94U, 0x4B82460DU, 0x5820DE7AU,
+		0xFBC3FAF9U, 0xE861628EU, 0xDC86CA17U, 0xCF245260U,
+		0xB5499B25U, 0xA6EB0352U, 0x920CABCBU, 0x81AE33BCU,
+		0x66D73941U, 0x7575A136U, 0x419209AFU, 0x523091D8U,
+		0x285D589DU, 0x3BFFC0EAU, 0x0F186873U, 0x1CBAF004U,
+		0xC4060B78U, 0xD7A4930FU, 0xE3433B96U, 0xF0E1A3E1U,
+		0x8A8C6AA4U, 0x992EF2D3U, 0xADC95A4AU, 0xBE6BC23DU,
+		0x5912C8C0U, 0x4AB050B7U, 0x7E57F82EU, 0x6DF56059U,
+		0x1798A91CU, 0x043A316BU, 0x30DD99F2U, 0x237F0185U,
+		0x844819FBU, 0x97EA818CU, 0xA30D2915U, 0xB0AFB162U,
+		0xCAC27827U, 0xD960E050U, 0xED8748C9U, 0xFE25D0BEU,
+		0x195CDA43U, 0x0AFE4234U, 0x3E19EAADU, 0x2DBB72DAU,
+		0x57D6BB9FU, 0x447423E8U, 0x70938B71U, 0x63311306U,
+		0xBB8DE87AU, 0xA82F700DU, 0x9CC8D894U, 0x8F6A40E3U,
+		0xF50789A6U, 0xE6A511D1U, 0xD242B948U, 0xC1E0213FU,
+		0x26992BC2U, 0x353BB3B5U, 0x01DC1B2CU, 0x127E835BU,
+		0x68134A1EU, 0x7BB1D269U, 0x4F567AF0U, 0x5CF4E287U,
+		0x04D43CFDU, 0x1776A48AU, 0x23910C13U, 0x30339464U,
+		0x4A5E5D21U, 0x59FCC556U, 0x6D1B6DCFU, 0x7EB9F5B8U,
+		0x99C0FF45U, 0x8A626732U, 0xBE85CFABU, 0xAD2757DCU,
+		0xD74A9E99U, 0xC4E806EEU, 0xF00FAE77U, 0xE3AD3600U,
+		0x3B11CD7CU, 0x28B3550BU, 0x1C54FD92U, 0x0FF665E5U,
+		0x759BACA0U, 0x663934D7U, 0x52DE9C4EU, 0x417C0439U,
+		0xA6050EC4U, 0xB5A796B3U, 0x81403E2AU, 0x92E2A65DU,
+		0xE88F6F18U, 0xFB2DF76FU, 0xCFCA5FF6U, 0xDC68C781U,
+		0x7B5FDFFFU, 0x68FD4788U, 0x5C1AEF11U, 0x4FB87766U,
+		0x35D5BE23U, 0x26772654U, 0x12908ECDU, 0x013216BAU,
+		0xE64B1C47U, 0xF5E98430U, 0xC10E2CA9U, 0xD2ACB4DEU,
+		0xA8C17D9BU, 0xBB63E5ECU, 0x8F844D75U, 0x9C26D502U,
+		0x449A2E7EU, 0x5738B609U, 0x63DF1E90U, 0x707D86E7U,
+		0x0A104FA2U, 0x19B2D7D5U, 0x2D557F4CU, 0x3EF7E73BU,
+		0xD98EEDC6U, 0xCA2C75B1U, 0xFECBDD28U, 0xED69455FU,
+		0x97048C1AU, 0x84A6146DU, 0xB041BCF4U, 0xA3E32483U,
+	},
+	{
+		0x00000000U, 0xA541927EU, 0x4F6F520DU, 0xEA2EC073U,
+		0x9EDEA41AU, 0x3B9F3664U, 0xD1B1F617U, 0x74F06469U,
+		0x38513EC5U, 0x9D10ACBBU, 0x773E6CC8U, 0xD27FFEB6U,
+		0xA68F9ADFU, 0x03CE08A1U, 0xE9E0C8D2U, 0x4CA15AACU,
+		0x70A27D8AU, 0xD5E3EFF4U, 0x3FCD2F87U, 0x9A8CBDF9U,
+		0xEE7CD990U, 0x4B3D4BEEU, 0xA1138B9DU, 0x045219E3U,
+		0x48F3434FU, 0xEDB2D131U, 0x079C1142U, 0xA2DD833CU,
+		0xD62DE755U, 0x736C752BU, 0x9942B558U, 0x3C032726U,
+		0xE144FB14U, 0x4405696AU, 0xAE2BA919U, 0x0B6A3B67U,
+		0x7F9A5F0EU, 0xDADBCD70U, 0x30F50D03U, 0x95B49F7DU,
+		0xD915C5D1U, 0x7C5457AFU, 0x967A97DCU, 0x333B05A2U,
+		0x47CB61CBU, 0xE28AF3B5U, 0x08A433C6U, 0xADE5A1B8U,
+		0x91E6869EU, 0x34A714E0U, 0xDE89D493U, 0x7BC846EDU,
+		0x0F382284U, 0xAA79B0FAU, 0x40577089U, 0xE516E2F7U,
+		0xA9B7B85BU, 0x0CF62A25U, 0xE6D8EA56U, 0x43997828U,
+		0x37691C41U, 0x92288E3FU, 0x78064E4CU, 0xDD47DC32U,
+		0xC76580D9U, 0x622412A7U, 0x880AD2D4U, 0x2D4B40AAU,
+		0x59BB24C3U, 0xFCFAB6BDU, 0x16D476CEU, 0xB395E4B0U,
+		0xFF34BE1CU, 0x5A752C62U, 0xB05BEC11U, 0x151A7E6FU,
+		0x61EA1A06U, 0xC4AB8878U, 0x2E85480BU, 0x8BC4DA75U,
+		0xB7C7FD53U, 0x12866F2DU, 0xF8A8AF5EU, 0x5DE93D20U,
+		0x29195949U, 0x8C58CB37U, 0x66760B44U, 0xC337993AU,
+		0x8F96C396U, 0x2AD751E8U, 0xC0F9919BU, 0x65B803E5U,
+		0x1148678CU, 0xB409F5F2U, 0x5E273581U, 0xFB66A7FFU,
+		0x26217BCDU, 0x8360E9B3U, 0x694E29C0U, 0xCC0FBBBEU,
+		0xB8FFDFD7U, 0x1DBE4DA9U, 0xF7908DDAU, 0x52D11FA4U,
+		0x1E704508U, 0xBB31D776U, 0x511F1705U, 0xF45E857BU,
+		0x80AEE112U, 0x25EF736CU, 0xCFC1B31FU, 0x6A802161U,
+		0x56830647U, 0xF3C29439U, 0x19EC544AU, 0xBCADC634U,
+		0xC85DA25DU, 0x6D1C3023U, 0x8732F050U, 0x2273622EU,
+		0x6ED23882U, 0xCB93AAFCU, 0x21BD6A8FU, 0x84FCF8F1U,
+		0xF00C9C98U, 0x554D0EE6U, 0xBF63CE95U, 0x1A225CEBU,
+		0x8B277743U, 0x2E66E53DU, 0xC448254EU, 0x6109B730U,
+		0x15F9D359U, 0xB0B84127U, 0x5A968154U, 0xFFD7132AU,
+		0xB3764986U, 0x1637DBF8U, 0xFC191B8BU, 0x595889F5U,
+		0x2DA8ED9CU, 0x88E97FE2U, 0x62C7BF91U, 0xC7862DEFU,
+		0xFB850AC9U, 0x5EC498B7U, 0xB4EA58C4U, 0x11ABCABAU,
+		0x655BAED3U, 0xC01A3CADU, 0x2A34FCDEU, 0x8F756EA0U,
+		0xC3D4340CU, 0x6695A672U, 0x8CBB6601U, 0x29FAF47FU,
+		0x5D0A9016U, 0xF84B0268U, 0x1265C21BU, 0xB7245065U,
+		0x6A638C57U, 0xCF221E29U, 0x250CDE5AU, 0x804D4C24U,
+		0xF4BD284DU, 0x51FCBA33U, 0xBBD27A40U, 0x1E93E83EU,
+		0x5232B292U, 0xF77320ECU, 0x1D5DE09FU, 0xB81C72E1U,
+		0xCCEC1688U, 0x69AD84F6U, 0x83834485U, 0x26C2D6FBU,
+		0x1AC1F1DDU, 0xBF8063A3U, 0x55AEA3D0U, 0xF0EF31AEU,
+		0x841F55C7U, 0x215EC7B9U, 0xCB7007CAU, 0x6E3195B4U,
+		0x2290CF18U, 0x87D15D66U, 0x6DFF9D15U, 0xC8BE0F6BU,
+		0xBC4E6B02U, 0x190FF97CU, 0xF321390FU, 0x5660AB71U,
+		0x4C42F79AU, 0xE90365E4U, 0x032DA597U, 0xA66C37E9U,
+		0xD29C5380U, 0x77DDC1FEU, 0x9DF3018DU, 0x38B293F3U,
+		0x7413C95FU, 0xD1525B21U, 0x3B7C9B52U, 0x9E3D092CU,
+		0xEACD6D45U, 0x4F8CFF3BU, 0xA5A23F48U, 0x00E3AD36U,
+		0x3CE08A10U, 0x99A1186EU, 0x738FD81DU, 0xD6CE4A63U,
+		0xA23E2E0AU, 0x077FBC74U, 0xED517C07U, 0x4810EE79U,
+		0x04B1B4D5U, 0xA1F026ABU, 0x4BDEE6D8U, 0xEE9F74A6U,
+		0x9A6F10CFU, 0x3F2E82B1U, 0xD50042C2U, 0x7041D0BCU,
+		0xAD060C8EU, 0x08479EF0U, 0xE2695E83U, 0x4728CCFDU,
+		0x33D8A894U, 0x96993AEAU, 0x7CB7FA99U, 0xD9F668E7U,
+		0x9557324BU, 0x3016A035U, 0xDA386046U, 0x7F79F238U,
+		0x0B899651U, 0xAEC8042FU, 0x44E6C45CU, 0xE1A75622U,
+		0xDDA47104U, 0x78E5E37AU, 0x92CB2309U, 0x378AB177U,
+		0x437AD51EU, 0xE63B4760U, 0x0C158713U, 0xA954156DU,
+		0xE5F54FC1U, 0x40B4DDBFU, 0xAA9A1DCCU, 0x0FDB8FB2U,
+		0x7B2BEBDBU, 0xDE6A79A5U, 0x3444B9D6U, 0x91052BA8U,
+	},
+	{
+		0x00000000U, 0xDD45AAB8U, 0xBF672381U, 0x62228939U,
+		0x7B2231F3U, 0xA6679B4BU, 0xC4451272U, 0x1900B8CAU,
+		0xF64463E6U, 0x2B01C95EU, 0x49234067U, 0x9466EADFU,
+		0x8D665215U, 0x5023F8ADU, 0x32017194U, 0xEF44DB2CU,
+		0xE964B13DU, 0x34211B85U, 0x560392BCU, 0x8B463804U,
+		0x924680CEU, 0x4F032A76U, 0x2D21A34FU, 0xF06409F7U,
+		0x1F20D2DBU, 0xC2657863U, 0xA047F15AU, 0x7D025BE2U,
+		0x6402E328U, 0xB9474990U, 0xDB65C0A9U, 0x06206A11U,
+		0xD725148BU, 0x0A60BE33U, 0x6842370AU, 0xB5079DB2U,
+		0xAC072578U, 0x71428FC0U, 0x136006F9U, 0xCE25AC41U,
+		0x2161776DU, 0xFC24DDD5U, 0x9E0654ECU, 0x4343FE54U,
+		0x5A43469EU, 0x8706EC26U, 0xE524651FU, 0x3861CFA7U,
+		0x3E41A5B6U, 0xE3040F0EU, 0x81268637U, 0x5C632C8FU,
+		0x45639445U, 0x98263EFDU, 0xFA04B7C4U, 0x27411D7CU,
+		0xC805C650U, 0x15406CE8U, 0x7762E5D1U, 0xAA274F69U,
+		0xB327F7A3U, 0x6E625D1BU, 0x0C40D422U, 0xD1057E9AU,
+		0xABA65FE7U, 0x76E3F55FU, 0x14C17C66U, 0xC984D6DEU,
+		0xD0846E14U, 0x0DC1C4ACU, 0x6FE34D95U, 0xB2A6E72DU,
+		0x5DE23C01U, 0x80A796B9U, 0xE2851F80U, 0x3FC0B538U,
+		0x26C00DF2U, 0xFB85A74AU, 0x99A72E73U, 0x44E284CBU,
+		0x42C2EEDAU, 0x9F874462U, 0xFDA5CD5BU, 0x20E067E3U,
+		0x39E0DF29U, 0xE4A57591U, 0x8687FCA8U, 0x5BC25610U,
+		0xB4868D3CU, 0x69C32784U, 0x0BE1AEBDU, 0xD6A40405U,
+		0xCFA4BCCFU, 0x12E11677U, 0x70C39F4EU, 0xAD8635F6U,
+		0x7C834B6CU, 0xA1C6E1D4U, 0xC3E468EDU, 0x1EA1C255U,
+		0x07A17A9FU, 0xDAE4D027U, 0xB8C6591EU, 0x6583F3A6U,
+		0x8AC7288AU, 0x57828232U, 0x35A00B0BU, 0xE8E5A1B3U,
+		0xF1E51979U, 0x2CA0B3C1U, 0x4E823AF8U, 0x93C79040U,
+		0x95E7FA51U, 0x48A250E9U, 0x2A80D9D0U, 0xF7C57368U,
+		0xEEC5CBA2U, 0x3380611AU, 0x51A2E823U, 0x8CE7429BU,
+		0x63A399B7U, 0xBEE6330FU, 0xDCC4BA36U, 0x0181108EU,
+		0x1881A844U, 0xC5C402FCU, 0xA7E68BC5U, 0x7AA3217DU,
+		0x52A0C93FU, 0x8FE56387U, 0xEDC7EABEU, 0x30824006U,
+		0x2982F8CCU, 0xF4C75274U, 0x96E5DB4DU, 0x4BA071F5U,
+		0xA4E4AAD9U, 0x79A10061U, 0x1B838958U, 0xC6C623E0U,
+		0xDFC69B2AU, 0x02833192U, 0x60A1B8ABU, 0xBDE41213U,
+		0xBBC47802U, 0x6681D2BAU, 0x04A35B83U, 0xD9E6F13BU,
+		0xC0E649F1U, 0x1DA3E349U, 0x7F816A70U, 0xA2C4C0C8U,
+		0x4D801BE4U, 0x90C5B15CU, 0xF2E73865U, 0x2FA292DDU,
+		0x36A22A17U, 0xEBE780AFU, 0x89C50996U, 0x5480A32EU,
+		0x8585DDB4U, 0x58C0770CU, 0x3AE2FE35U, 0xE7A7548DU,
+		0xFEA7EC47U, 0x23E246FFU, 0x41C0CFC6U, 0x9C85657EU,
+		0x73C1BE52U, 0xAE8414EAU, 0xCCA69DD3U, 0x11E3376BU,
+		0x08E38FA1U, 0xD5A62519U, 0xB784AC20U, 0x6AC10698U,
+		0x6CE16C89U, 0xB1A4C631U, 0xD3864F08U, 0x0EC3E5B0U,
+		0x17C35D7AU, 0xCA86F7C2U, 0xA8A47EFBU, 0x75E1D443U,
+		0x9AA50F6FU, 0x47E0A5D7U, 0x25C22CEEU, 0xF8878656U,
+		0xE1873E9CU, 0x3CC29424U, 0x5EE01D1DU, 0x83A5B7A5U,
+		0xF90696D8U, 0x24433C60U, 0x4661B559U, 0x9B241FE1U,
+		0x8224A72BU, 0x5F610D93U, 0x3D4384AAU, 0xE0062E12U,
+		0x0F42F53EU, 0xD2075F86U, 0xB025D6BFU, 0x6D607C07U,
+		0x7460C4CDU, 0xA9256E75U, 0xCB07E74CU, 0x16424DF4U,
+		0x106227E5U, 0xCD278D5DU, 0xAF050464U, 0x7240AEDCU,
+		0x6B401616U, 0xB605BCAEU, 0xD4273597U, 0x09629F2FU,
+		0xE6264403U, 0x3B63EEBBU, 0x59416782U, 0x8404CD3AU,
+		0x9D0475F0U, 0x4041DF48U, 0x22635671U, 0xFF26FCC9U,
+		0x2E238253U, 0xF36628EBU, 0x9144A1D2U, 0x4C010B6AU,
+		0x5501B3A0U, 0x88441918U, 0xEA669021U, 0x37233A99U,
+		0xD867E1B5U, 0x05224B0DU, 0x6700C234U, 0xBA45688CU,
+		0xA345D046U, 0x7E007AFEU, 0x1C22F3C7U, 0xC167597FU,
+		0xC747336EU, 0x1A0299D6U, 0x782010EFU, 0xA565BA57U,
+		0xBC65029DU, 0x6120A825U, 0x0302211CU, 0xDE478BA4U,
+		0x31035088U, 0xEC46FA30U, 0x8E647309U, 0x5321D9B1U,
+		0x4A21617BU, 0x9764CBC3U, 0xF54642FAU, 0x2803E842U,
+	},
+#endif /* CONFIG_CRC32_SLICES >= 4 */
+#if CONFIG_CRC32_SLICES >= 8
+	{
+		0x00000000U, 0x38116FACU, 0x7022DF58U, 0x4833B0F4U,
+		0xE045BEB0U, 0xD854D11CU, 0x906761E8U, 0xA8760E44U,
+		0xC5670B91U, 0xFD76643DU, 0xB545D4C9U, 0x8D54BB65U,
+		0x2522B521U, 0x1D33DA8DU, 0x55006A79U, 0x6D1105D5U,
+		0x8F2261D3U, 0xB7330E7FU, 0xFF00BE8BU, 0xC711D127U,
+		0x6F67DF63U, 0x5776B0CFU, 0x1F45003BU, 0x27546F97U,
+		0x4A456A42U, 0x725405EEU, 0x3A67B51AU, 0x0276DAB6U,
+		0xAA00D4F2U, 0x9211BB5EU, 0xDA220BAAU, 0xE2336406U,
+		0x1BA8B557U, 0x23B9DAFBU, 0x6B8A6A0FU, 0x539B05A3U,
+		0xFBED0BE7U, 0xC3FC644BU, 0x8BCFD4BFU, 0xB3DEBB13U,
+		0xDECFBEC6U, 0xE6DED16AU, 0xAEED619EU, 0x96FC0E32U,
+		0x3E8A0076U, 0x069B6FDAU, 0x4EA8DF2EU, 0x76B9B082U,
+		0x948AD484U, 0xAC9BBB28U, 0xE4A80BDCU, 0xDCB96470U,
+		0x74CF6A34U, 0x4CDE0598U, 0x04EDB56CU, 0x3CFCDAC0U,
+		0x51EDDF15U, 0x69FCB0B9U, 0x21CF004DU, 0x19DE6FE1U,
+		0xB1A861A5U, 0x89B90E09U, 0xC18ABEFDU, 0xF99BD151U,
+		0x37516AAEU, 0x0F400502U, 0x4773B5F6U, 0x7F62DA5AU,
+		0xD714D41EU, 0xEF05BBB2U, 0xA7360B46U, 0x9F2764EAU,
+		0xF236613FU, 0xCA270E93U, 0x8214BE67U, 0xBA05D1CBU,
+		0x1273DF8FU, 0x2A62B023U, 0x625100D7U, 0x5A406F7BU,
+		0xB8730B7DU, 0x806264D1U, 0xC851D425U, 0xF040BB89U,
+		0x5836B5CDU, 0x6027DA61U, 0x28146A95U, 0x10050539U,
+		0x7D1400ECU, 0x45056F40U, 0x0D36DFB4U, 0x3527B018U,
+		0x9D51BE5CU, 0xA540D1F0U, 0xED736104U, 0xD5620EA8U,
+		0x2CF9DFF9U, 0x14E8B055U, 0x5CDB00A1U, 0x64CA6F0DU,
+		0xCCBC6149U, 0xF4AD0EE5U, 0xBC9EBE11U, 0x848FD1BDU,
+		0xE99ED468U, 0xD18FBBC4U, 0x99BC0B30U, 0xA1AD649CU,
+		0x09DB6AD8U, 0x31CA0574U, 0x79F9B580U, 0x41E8DA2CU,
+		0xA3DBBE2AU, 0x9BCAD186U, 0xD3F96172U, 0xEBE80EDEU,
+		0x439E009AU, 0x7B8F6F36U, 0x33BCDFC2U, 0x0BADB06EU,
+		0x66BCB5BBU, 0x5EADDA17U, 0x169E6AE3U, 0x2E8F054FU,
+		0x86F90B0BU, 0xBEE864A7U, 0xF6DBD453U, 0xCECABBFFU,
+		0x6EA2D55CU, 0x56B3BAF0U, 0x1E800A04U, 0x269165A8U,
+		0x8EE76BECU, 0xB6F60440U, 0xFEC5B4B4U, 0xC6D4DB18U,
+		0xABC5DECDU, 0x93D4B161U, 0xDBE70195U, 0xE3F66E39U,
+		0x4B80607DU, 0x73910FD1U, 0x3BA2BF25U, 0x03B3D089U,
+		0xE180B48FU, 0xD991DB23U, 0x91A26BD7U, 0xA9B3047BU,
+		0x01C50A3FU, 0x39D46593U, 0x71E7D567U, 0x49F6BACBU,
+		0x24E7BF1EU, 0x1CF6D0B2U, 0x54C56046U, 0x6CD40FEAU,
+		0xC4A201AEU, 0xFCB36E02U, 0xB480DEF6U, 0x8C91B15AU,
+		0x750A600BU, 0x4D1B0FA7U, 0x0528BF53U, 0x3D39D0FFU,
+		0x954FDEBBU, 0xAD5EB117U, 0xE56D01E3U, 0xDD7C6E4FU,
+		0xB06D6B9AU, 0x887C0436U, 0xC04FB4C2U, 0xF85EDB6EU,
+		0x5028D52AU, 0x6839BA86U, 0x200A0A72U, 0x181B65DEU,
+		0xFA2801D8U, 0xC2396E74U, 0x8A0ADE80U, 0xB21BB12CU,
+		0x1A6DBF68U, 0x227CD0C4U, 0x6A4F6030U, 0x525E0F9CU,
+		0x3F4F0A49U, 0x075E65E5U, 0x4F6DD511U, 0x777CBABDU,
+		0xDF0AB4F9U, 0xE71BDB55U, 0xAF286BA1U, 0x9739040DU,
+		0x59F3BFF2U, 0x61E2D05EU, 0x29D160AAU, 0x11C00F06U,
+		0xB9B60142U, 0x81A76EEEU, 0xC994DE1AU, 0xF185B1B6U,
+		0x9C94B463U, 0xA485DBCFU, 0xECB66B3BU, 0xD4A70497U,
+		0x7CD10AD3U, 0x44C0657FU, 0x0CF3D58BU, 0x34E2BA27U,
+		0xD6D1DE21U, 0xEEC0B18DU, 0xA6F30179U, 0x9EE26ED5U,
+		0x36946091U, 0x0E850F3DU, 0x46B6BFC9U, 0x7EA7D065U,
+		0x13B6D5B0U, 0x2BA7BA1CU, 0x63940AE8U, 0x5B856544U,
+		0xF3F36B00U, 0xCBE204ACU, 0x83D1B458U, 0xBBC0DBF4U,
+		0x425B0AA5U, 0x7A4A6509U, 0x3279D5FDU, 0x0A68BA51U,
+		0xA21EB415U, 0x9A0FDBB9U, 0xD23C6B4DU, 0xEA2D04E1U,
+		0x873C0134U, 0xBF2D6E98U, 0xF71EDE6CU, 0xCF0FB1C0U,
+		0x6779BF84U, 0x5F68D028U, 0x175B60DCU, 0x2F4A0F70U,
+		0xCD796B76U, 0xF56804DAU, 0xBD5BB42EU, 0x854ADB82U,
+		0x2D3CD5C6U, 0x152DBA6AU, 0x5D1E0A9EU, 0x650F6532U,
+		0x081E60E7U, 0x300F0F4BU, 0x783CBFBFU, 0x402DD013U,
+		0xE85BDE57U, 0xD04AB1FBU, 0x9879010FU, 0xA0686EA3U,
+	},
+	{
+		0x00000000U, 0xEF306B19U, 0xDB8CA0C3U, 0x34BCCBDAU,
+		0xB2F53777U, 0x5DC55C6EU, 0x697997B4U, 0x8649FCADU,
+		0x6006181FU, 0x8F367306U, 0xBB8AB8DCU, 0x54BAD3C5U,
+		0xD2F32F68U, 0x3DC34471U, 0x097F8FABU, 0xE64FE4B2U,
+		0xC00C303EU, 0x2F3C5B27U, 0x1B8090FDU, 0xF4B0FBE4U,
+		0x72F90749U, 0x9DC96C50U, 0xA975A78AU, 0x4645CC93U,
+		0xA00A2821U, 0x4F3A4338U, 0x7B8688E2U, 0x94B6E3FBU,
+		0x12FF1F56U, 0xFDCF744FU, 0xC973BF95U, 0x2643D48CU,
+		0x85F4168DU, 0x6AC47D94U, 0x5E78B64EU, 0xB148DD57U,
+		0x370121FAU, 0xD8314AE3U, 0xEC8D8139U, 0x03BDEA20U,
+		0xE5F20E92U, 0x0AC2658BU, 0x3E7EAE51U, 0xD14EC548U,
+		0x570739E5U, 0xB83752FCU, 0x8C8B9926U, 0x63BBF23FU,
+		0x45F826B3U, 0xAAC84DAAU, 0x9E748670U, 0x7144ED69U,
+		0xF70D11C4U, 0x183D7ADDU, 0x2C81B107U, 0xC3B1DA1EU,
+		0x25FE3EACU, 0xCACE55B5U, 0xFE729E6FU, 0x1142F576U,
+		0x970B09DBU, 0x783B62C2U, 0x4C87A918U, 0xA3B7C201U,
+		0x0E045BEBU, 0xE13430F2U, 0xD588FB28U, 0x3AB89031U,
+		0xBCF16C9CU, 0x53C10785U, 0x677DCC5FU, 0x884DA746U,
+		0x6E0243F4U, 0x813228EDU, 0xB58EE337U, 0x5ABE882EU,
+		0xDCF77483U, 0x33C71F9AU, 0x077BD440U, 0xE84BBF59U,
+		0xCE086BD5U, 0x213800CCU, 0x1584CB16U, 0xFAB4A00FU,
+		0x7CFD5CA2U, 0x93CD37BBU, 0xA771FC61U, 0x48419778U,
+		0xAE0E73CAU, 0x413E18D3U, 0x7582D309U, 0x9AB2B810U,
+		0x1CFB44BDU, 0xF3CB2FA4U, 0xC777E47EU, 0x28478F67U,
+		0x8BF04D66U, 0x64C0267FU, 0x507CEDA5U, 0xBF4C86BCU,
+		0x39057A11U, 0xD6351108U, 0xE289DAD2U, 0x0DB9B1CBU,
+		0xEBF65579U, 0x04C63E60U, 0x307AF5BAU, 0xDF4A9EA3U,
+		0x5903620EU, 0xB6330917U, 0x828FC2CDU, 0x6DBFA9D4U,
+		0x4BFC7D58U, 0xA4CC1641U, 0x9070DD9BU, 0x7F40B682U,
+		0xF9094A2FU, 0x16392136U, 0x2285EAECU, 0xCDB581F5U,
+		0x2BFA6547U, 0xC4CA0E5EU, 0xF076C584U, 0x1F46AE9DU,
+		0x990F5230U, 0x763F3929U, 0x4283F2F3U, 0xADB399EAU,
+		0x1C08B7D6U, 0xF338DCCFU, 0xC7841715U, 0x28B47C0CU,
+		0xAEFD80A1U, 0x41CDEBB8U, 0x75712062U, 0x9A414B7BU,
+		0x7C0EAFC9U, 0x933EC4D0U, 0xA7820F0AU, 0x48B26413U,
+		0xCEFB98BEU, 0x21CBF3A7U, 0x1577387DU, 0xFA475364U,
+		0xDC0487E8U, 0x3334ECF1U, 0x0788272BU, 0xE8B84C32U,
+		0x6EF1B09FU, 0x81C1DB86U, 0xB57D105CU, 0x5A4D7B45U,
+		0xBC029FF7U, 0x5332F4EEU, 0x678E3F34U, 0x88BE542DU,
+		0x0EF7A880U, 0xE1C7C399U, 0xD57B0843U, 0x3A4B635AU,
+		0x99FCA15BU, 0x76CCCA42U, 0x42700198U, 0xAD406A81U,
+		0x2B09962CU, 0xC439FD35U, 0xF08536EFU, 0x1FB55DF6U,
+		0xF9FAB944U, 0x16CAD25DU, 0x22761987U, 0xCD46729EU,
+		0x4B0F8E33U, 0xA43FE52AU, 0x90832EF0U, 0x7FB345E9U,
+		0x59F09165U, 0xB6C0FA7CU, 0x827C31A6U, 0x6D4C5ABFU,
+		0xEB05A612U, 0x0435CD0BU, 0x308906D1U, 0xDFB96DC8U,
+		0x39F6897AU, 0xD6C6E263U, 0xE27A29B9U, 0x0D4A42A0U,
+		0x8B03BE0DU, 0x6433D514U, 0x508F1ECEU, 0xBFBF75D7U,
+		0x120CEC3DU, 0xFD3C8724U, 0xC9804CFEU, 0x26B027E7U,
+		0xA0F9DB4AU, 0x4FC9B053U, 0x7B757B89U, 0x94451090U,
+		0x720AF422U, 0x9D3A9F3BU, 0xA98654E1U, 0x46B63FF8U,
+		0xC0FFC355U, 0x2FCFA84CU, 0x1B736396U, 0xF443088FU,
+		0xD200DC03U, 0x3D30B71AU, 0x098C7CC0U, 0xE6BC17D9U,
+		0x60F5EB74U, 0x8FC5806DU, 0xBB794BB7U, 0x544920AEU,
+		0xB206C41CU, 0x5D36AF05U, 0x698A64DFU, 0x86BA0FC6U,
+		0x00F3F36BU, 0xEFC39872U, 0xDB7F53A8U, 0x344F38B1U,
+		0x97F8FAB0U, 0x78C891A9U, 0x4C745A73U, 0xA344316AU,
+		0x250DCDC7U, 0xCA3DA6DEU, 0xFE816D04U, 0x11B1061DU,
+		0xF7FEE2AFU, 0x18CE89B6U, 0x2C72426CU, 0xC3422975U,
+		0x450BD5D8U, 0xAA3BBEC1U, 0x9E87751BU, 0x71B71E02U,
+		0x57F4CA8EU, 0xB8C4A197U, 0x8C786A4DU, 0x63480154U,
+		0xE501FDF9U, 0x0A3196E0U, 0x3E8D5D3AU, 0xD1BD3623U,
+		0x37F2D291U, 0xD8C2B988U, 0xEC7E7252U, 0x034E194BU,
+		0x8507E5E6U, 0x6A378EFFU, 0x5E8B4525U, 0xB1BB2E3CU,
+	},
+	{
+		0x00000000U, 0x68032CC8U, 0xD0065990U, 0xB8057558U,
+		0xA5E0C5D1U, 0xCDE3E919U, 0x75E69C41U, 0x1DE5B089U,
+		0x4E2DFD53U, 0x262ED19BU, 0x9E2BA4C3U, 0xF628880BU,
+		0xEBCD3882U, 0x83CE144AU, 0x3BCB6112U, 0x53C84DDAU,
+		0x9C5BFAA6U, 0xF458D66EU, 0x4C5DA336U, 0x245E8FFEU,
+		0x39BB3F77U, 0x51B813BFU, 0xE9BD66E7U, 0x81BE4A2FU,
+		0xD27607F5U, 0xBA752B3DU, 0x02705E65U, 0x6A7372ADU,
+		0x7796C224U, 0x1F95EEECU, 0xA7909BB4U, 0xCF93B77CU,
+		0x3D5B83BDU, 0x5558AF75U, 0xED5DDA2DU, 0x855EF6E5U,
+		0x98BB466CU, 0xF0B86AA4U, 0x48BD1FFCU, 0x20BE3334U,
+		0x73767EEEU, 0x1B755226U, 0xA370277EU, 0xCB730BB6U,
+		0xD696BB3FU, 0xBE9597F7U, 0x0690E2AFU, 0x6E93CE67U,
+		0xA100791BU, 0xC90355D3U, 0x7106208BU, 0x19050C43U,
+		0x04E0BCCAU, 0x6CE39002U, 0xD4E6E55AU, 0xBCE5C992U,
+		0xEF2D8448U, 0x872EA880U, 0x3F2BDDD8U, 0x5728F110U,
+		0x4ACD4199U, 0x22CE6D51U, 0x9ACB1809U, 0xF2C834C1U,
+		0x7AB7077AU, 0x12B42BB2U, 0xAAB15EEAU, 0xC2B27222U,
+		0xDF57C2ABU, 0xB754EE63U, 0x0F519B3BU, 0x6752B7F3U,
+		0x349AFA29U, 0x5C99D6E1U, 0xE49CA3B9U, 0x8C9F8F71U,
+		0x917A3FF8U, 0xF9791330U, 0x417C6668U, 0x297F4AA0U,
+		0xE6ECFDDCU, 0x8EEFD114U, 0x36EAA44CU, 0x5EE98884U,
+		0x430C380DU, 0x2B0F14C5U, 0x930A619DU, 0xFB094D55U,
+		0xA8C1008FU, 0xC0C22C47U, 0x78C7591FU, 0x10C475D7U,
+		0x0D21C55EU, 0x6522E996U, 0xDD279CCEU, 0xB524B006U,
+		0x47EC84C7U, 0x2FEFA80FU, 0x97EADD57U, 0xFFE9F19FU,
+		0xE20C4116U, 0x8A0F6DDEU, 0x320A1886U, 0x5A09344EU,
+		0x09C17994U, 0x61C2555CU, 0xD9C72004U, 0xB1C40CCCU,
+		0xAC21BC45U, 0xC422908DU, 0x7C27E5D5U, 0x1424C91DU,
+		0xDBB77E61U, 0xB3B452A9U, 0x0BB127F1U, 0x63B20B39U,
+		0x7E57BBB0U, 0x16549778U, 0xAE51E220U, 0xC652CEE8U,
+		0x959A8332U, 0xFD99AFFAU, 0x459CDAA2U, 0x2D9FF66AU,
+		0x307A46E3U, 0x58796A2BU, 0xE07C1F73U, 0x887F33BBU,
+		0xF56E0EF4U, 0x9D6D223CU, 0x25685764U, 0x4D6B7BACU,
+		0x508ECB25U, 0x388DE7EDU, 0x808892B5U, 0xE88BBE7DU,
+		0xBB43F3A7U, 0xD340DF6FU, 0x6B45AA37U, 0x034686FFU,
+		0x1EA33676U, 0x76A01ABEU, 0xCEA56FE6U, 0xA6A6432EU,
+		0x6935F452U, 0x0136D89AU, 0xB933ADC2U, 0xD130810AU,
+		0xCCD53183U, 0xA4D61D4BU, 0x1CD36813U, 0x74D044DBU,
+		0x27180901U, 0x4F1B25C9U, 0xF71E5091U, 0x9F1D7C59U,
+		0x82F8CCD0U, 0xEAFBE018U, 0x52FE9540U, 0x3AFDB988U,
+		0xC8358D49U, 0xA036A181U, 0x1833D4D9U, 0x7030F811U,
+		0x6DD54898U, 0x05D66450U, 0xBDD31108U, 0xD5D03DC0U,
+		0x8618701AU, 0xEE1B5CD2U, 0x561E298AU, 0x3E1D0542U,
+		0x23F8B5CBU, 0x4BFB9903U, 0xF3FEEC5BU, 0x9BFDC093U,
+		0x546E77EFU, 0x3C6D5B27U, 0x84682E7FU, 0xEC6B02B7U,
+		0xF18EB23EU, 0x998D9EF6U, 0x2188EBAEU, 0x498BC766U,
+		0x1A438ABCU, 0x7240A674U, 0xCA45D32CU, 0xA246FFE4U,
+		0xBFA34F6DU, 0xD7A063A5U, 0x6FA516FDU, 0x07A63A35U,
+		0x8FD9098EU, 0xE7DA2546U, 0x5FDF501EU, 0x37DC7CD6U,
+		0x2A39CC5FU, 0x423AE097U, 0xFA3F95CFU, 0x923CB907U,
+		0xC1F4F4DDU, 0xA9F7D815U, 0x11F2AD4DU, 0x79F18185U,
+		0x6414310CU, 0x0C171DC4U, 0xB412689CU, 0xDC114454U,
+		0x1382F328U, 0x7B81DFE0U, 0xC384AAB8U, 0xAB878670U,
+		0xB66236F9U, 0xDE611A31U, 0x66646F69U, 0x0E6743A1U,
+		0x5DAF0E7BU, 0x35AC22B3U, 0x8DA957EBU, 0xE5AA7B23U,
+		0xF84FCBAAU, 0x904CE762U, 0x2849923AU, 0x404ABEF2U,
+		0xB2828A33U, 0xDA81A6FBU, 0x6284D3A3U, 0x0A87FF6BU,
+		0x17624FE2U, 0x7F61632AU, 0xC7641672U, 0xAF673ABAU,
+		0xFCAF7760U, 0x94AC5BA8U, 0x2CA92EF0U, 0x44AA0238U,
+		0x594FB2B1U, 0x314C9E79U, 0x8949EB21U, 0xE14AC7E9U,
+		0x2ED97095U, 0x46DA5C5DU, 0xFEDF2905U, 0x96DC05CDU,
+		0x8B39B544U, 0xE33A998CU, 0x5B3FECD4U, 0x333CC01CU,
+		0x60F48DC6U, 0x08F7A10EU, 0xB0F2D456U, 0xD8F1F89EU,
+		0xC5144817U, 0xAD1764DFU, 0x15121187U, 0x7D113D4FU,
+	},
+	{
+		0x00000000U, 0x493C7D27U, 0x9278FA4EU, 0xDB448769U,
+		0x211D826DU, 0x6821FF4AU, 0xB3657823U, 0xFA590504U,
+		0x423B04DAU, 0x0B0779FDU, 0xD043FE94U, 0x997F83B3U,
+		0x632686B7U, 0x2A1AFB90U, 0xF15E7CF9U, 0xB86201DEU,
+		0x847609B4U, 0xCD4A7493U, 0x160EF3FAU, 0x5F328EDDU,
+		0xA56B8BD9U, 0xEC57F6FEU, 0x37137197U, 0x7E2F0CB0U,
+		0xC64D0D6EU, 0x8F717049U, 0x5435F720U, 0x1D098A07U,
+		0xE7508F03U, 0xAE6CF224U, 0x7528754DU, 0x3C14086AU,
+		0x0D006599U, 0x443C18BEU, 0x9F789FD7U, 0xD644E2F0U,
+		0x2C1DE7F4U, 0x65219AD3U, 0xBE651DBAU, 0xF759609DU,
+		0x4F3B6143U, 0x06071C64U, 0xDD439B0DU, 0x947FE62AU,
+		0x6E26E32EU, 0x271A9E09U, 0xFC5E1960U, 0xB5626447U,
+		0x89766C2DU, 0xC04A110AU, 0x1B0E9663U, 0x5232EB44U,
+		0xA86BEE40U, 0xE1579367U, 0x3A13140EU, 0x732F6929U,
+		0xCB4D68F7U, 0x827115D0U, 0x593592B9U, 0x1009EF9EU,
+		0xEA50EA9AU, 0xA36C97BDU, 0x782810D4U, 0x31146DF3U,
+		0x1A00CB32U, 0x533CB615U, 0x8878317CU, 0xC1444C5BU,
+		0x3B1D495FU, 0x72213478U, 0xA965B311U, 0xE059CE36U,
+		0x583BCFE8U, 0x1107B2CFU, 0xCA4335A6U, 0x837F4881U,
+		0x79264D85U, 0x301A30A2U, 0xEB5EB7CBU, 0xA262CAECU,
+		0x9E76C286U, 0xD74ABFA1U, 0x0C0E38C8U, 0x453245EFU,
+		0xBF6B40EBU, 0xF6573DCCU, 0x2D13BAA5U, 0x642FC782U,
+		0xDC4DC65CU, 0x9571BB7BU, 0x4E353C12U, 0x07094135U,
+		0xFD504431U, 0xB46C3916U, 0x6F28BE7FU, 0x2614C358U,
+		0x1700AEABU, 0x5E3CD38CU, 0x857854E5U, 0xCC4429C2U,
+		0x361D2CC6U, 0x7F2151E1U, 0xA465D688U, 0xED59ABAFU,
+		0x553BAA71U, 0x1C07D756U, 0xC743503FU, 0x8E7F2D18U,
+		0x7426281CU, 0x3D1A553BU, 0xE65ED252U, 0xAF62AF75U,
+		0x9376A71FU, 0xDA4ADA38U, 0x010E5D51U, 0x48322076U,
+		0xB26B2572U, 0xFB575855U, 0x2013DF3CU, 0x692FA21BU,
+		0xD14DA3C5U, 0x9871DEE2U, 0x4335598BU, 0x0A0924ACU,
+		0xF05021A8U, 0xB96C5C8FU, 0x6228DBE6U, 0x2B14A6C1U,
+		0x34019664U, 0x7D3DEB43U, 0xA6796C2AU, 0xEF45110DU,
+		0x151C1409U, 0x5C20692EU, 0x8764EE47U, 0xCE589360U,
+		0x763A92BEU, 0x3F06EF99U, 0xE44268F0U, 0xAD7E15D7U,
+		0x572710D3U, 0x1E1B6DF4U, 0xC55FEA9DU, 0x8C6397BAU,
+		0xB0779FD0U, 0xF94BE2F7U, 0x220F659EU, 0x6B3318B9U,
+		0x916A1DBDU, 0xD856609AU, 0x0312E7F3U, 0x4A2E9AD4U,
+		0xF24C9B0AU, 0xBB70E62DU, 0x60346144U, 0x29081C63U,
+		0xD3511967U, 0x9A6D6440U, 0x4129E329U, 0x08159E0EU,
+		0x3901F3FDU, 0x703D8EDAU, 0xAB7909B3U, 0xE2457494U,
+		0x181C7190U, 0x51200CB7U, 0x8A648BDEU, 0xC358F6F9U,
+		0x7B3AF727U, 0x32068A00U, 0xE9420D69U, 0xA07E704EU,
+		0x5A27754AU, 0x131B086DU, 0xC85F8F04U, 0x8163F223U,
+		0xBD77FA49U, 0xF44B876EU, 0x2F0F0007U, 0x66337D20U,
+		0x9C6A7824U, 0xD5560503U, 0x0E12826AU, 0x472EFF4DU,
+		0xFF4CFE93U, 0xB67083B4U, 0x6D3404DDU, 0x240879FAU,
+		0xDE517CFEU, 0x976D01D9U, 0x4C2986B0U, 0x0515FB97U,
+		0x2E015D56U, 0x673D2071U, 0xBC79A718U, 0xF545DA3FU,
+		0x0F1CDF3BU, 0x4620A21CU, 0x9D642575U, 0xD4585852U,
+		0x6C3A598CU, 0x250624ABU, 0xFE42A3C2U, 0xB77EDEE5U,
+		0x4D27DBE1U, 0x041BA6C6U, 0xDF5F21AFU, 0x96635C88U,
+		0xAA7754E2U, 0xE34B29C5U, 0x380FAEACU, 0x7133D38BU,
+		0x8B6AD68FU, 0xC256ABA8U, 0x19122CC1U, 0x502E51E6U,
+		0xE84C5038U, 0xA1702D1FU, 0x7A34AA76U, 0x3308D751U,
+		0xC951D255U, 0x806DAF72U, 0x5B29281BU, 0x1215553CU,
+		0x230138CFU, 0x6A3D45E8U, 0xB179C281U, 0xF845BFA6U,
+		0x021CBAA2U, 0x4B20C785U, 0x906440ECU, 0xD9583DCBU,
+		0x613A3C15U, 0x28064132U, 0xF342C65BU, 0xBA7EBB7CU,
+		0x4027BE78U, 0x091BC35FU, 0xD25F4436U, 0x9B633911U,
+		0xA777317BU, 0xEE4B4C5CU, 0x350FCB35U, 0x7C33B612U,
+		0x866AB316U, 0xCF56CE31U, 0x14124958U, 0x5D2E347FU,
+		0xE54C35A1U, 0xAC704886U, 0x7734CFEFU, 0x3E08B2C8U,
+		0xC451B7CCU, 0x8D6DCAEBU, 0x56294D82U, 0x1F1530A5U,
+	},
+#endif /* CONFIG_CRC32_SLICES >= 8 */
+};
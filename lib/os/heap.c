@@ -37,11 +37,11 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 
 	CHECK(!chunk_used(h, c));
 	CHECK(b->next != 0);
-	CHECK(h->avail_buckets & BIT(bidx));
+	CHECK(bucket_avail(h, bidx));
 
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
-		h->avail_buckets &= ~BIT(bidx);
+		set_bucket_avail(h, bidx, false);
 		b->next = 0;
 	} else {
 		chunkid_t first = prev_free_chunk(h, c),
@@ -70,15 +70,15 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
 	if (b->next == 0U) {
-		CHECK((h->avail_buckets & BIT(bidx)) == 0);
+		CHECK(!bucket_avail(h, bidx));
 
 		/* Empty list, first item */
-		h->avail_buckets |= BIT(bidx);
+		set_bucket_avail(h, bidx, true);
 		b->next = c;
 		set_prev_free_chunk(h, c, c);
 		set_next_free_chunk(h, c, c);
 	} else {
-		CHECK(h->avail_buckets & BIT(bidx));
+		CHECK(bucket_avail(h, bidx));
 
 		/* Insert before (!) the "next" pointer */
 		chunkid_t second = b->next;
@@ -208,6 +208,55 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Two-level segregated fit: round the request up to the next subrange
+ * boundary so that every chunk in that list or above is guaranteed to
+ * fit, then take the first chunk of the first non-empty list found by
+ * two bitmap scans.  Constant time, no list walking.
+ */
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+{
+	uint32_t usable_sz = sz - min_chunk_size(h) + 1;
+	int fl = 31 - __builtin_clz(usable_sz);
+	int bi = bucket_idx(h, sz);
+	uint32_t slmap, flmap;
+
+	/* Categories below SL_COUNT hold a single size per list */
+	if (fl >= SL_LOG2) {
+		bi = tlsf_idx(usable_sz + BIT(fl - SL_LOG2) - 1U);
+	}
+
+	fl = bi >> SL_LOG2;
+	slmap = h->sl_avail[fl] & ~BIT_MASK(bi & (SL_COUNT - 1));
+	if (slmap == 0U) {
+		flmap = (fl < 31) ? (h->avail_buckets & ~BIT_MASK(fl + 1)) : 0U;
+		if (flmap == 0U) {
+			/* Nothing above: the rounded down list may still
+			 * hold a chunk that fits.
+			 */
+			bi = bucket_idx(h, sz);
+			if (bucket_avail(h, bi) &&
+			    chunk_size(h, h->buckets[bi].next) >= sz) {
+				chunkid_t c = h->buckets[bi].next;
+
+				free_list_remove_bidx(h, c, bi);
+				return c;
+			}
+			return 0;
+		}
+		fl = __builtin_ctz(flmap);
+		slmap = h->sl_avail[fl];
+	}
+
+	bi = (fl << SL_LOG2) + __builtin_ctz(slmap);
+
+	chunkid_t c = h->buckets[bi].next;
+
+	free_list_remove_bidx(h, c, bi);
+	CHECK(chunk_size(h, c) >= sz);
+	return c;
+}
+#else
 static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 {
 	int bi = bucket_idx(h, sz);
@@ -259,6 +308,7 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 
 	return 0;
 }
+#endif /* CONFIG_SYS_HEAP_TLSF */
 
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
@@ -510,6 +560,9 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	heap->heap = h;
 	h->end_chunk = heap_sz;
 	h->avail_buckets = 0;
+#ifdef CONFIG_SYS_HEAP_TLSF
+	(void)memset(h->sl_avail, 0, sizeof(h->sl_avail));
+#endif
 
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->free_bytes = 0;
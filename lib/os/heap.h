@@ -41,7 +41,10 @@
  *   FREE_NEXT: Chunk ID of the next node in a free list.
  *
  * The free lists are circular lists, one for each power-of-two size
- * category.  The free list pointers exist only for free chunks,
+ * category.  With CONFIG_SYS_HEAP_TLSF each power-of-two category
+ * is further split in 2^CONFIG_SYS_HEAP_TLSF_SL_LOG2 linear
+ * subranges, each with its own list (a "two-level segregated fit"
+ * index).  The free list pointers exist only for free chunks,
  * obviously.  This memory is part of the user's buffer when
  * allocated.
  *
@@ -65,10 +68,20 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+#define SL_LOG2 CONFIG_SYS_HEAP_TLSF_SL_LOG2
+#define SL_COUNT (1U << SL_LOG2)
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
+	/* With TLSF: one bit per first-level category with free chunks */
 	uint32_t avail_buckets;
+#ifdef CONFIG_SYS_HEAP_TLSF
+	/* One bit per non-empty subrange list, for each category */
+	uint8_t sl_avail[32];
+#endif
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	size_t free_bytes;
 	size_t allocated_bytes;
@@ -247,12 +260,83 @@ static inline size_t chunksz_to_bytes(struct z_heap *h, chunksz_t chunksz_in)
 	return chunksz_in * CHUNK_UNIT - chunk_header_bytes(h);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Map a size in units above the minimum (1-based) to its list index.
+ * The subrange is taken from the SL_LOG2 bits below the leading one;
+ * categories smaller than SL_COUNT have fewer distinct sizes than
+ * subranges and leave some lists unused.
+ */
+static inline int tlsf_idx(uint32_t usable_sz)
+{
+	int fl = 31 - __builtin_clz(usable_sz);
+	uint32_t sl = (fl >= SL_LOG2) ? (usable_sz >> (fl - SL_LOG2))
+				      : (usable_sz << (SL_LOG2 - fl));
+
+	return (fl << SL_LOG2) + (int)(sl - SL_COUNT);
+}
+
+static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
+{
+	return tlsf_idx(sz - min_chunk_size(h) + 1);
+}
+
+/* Smallest chunk size stored in list "bidx" */
+static inline chunksz_t bucket_min_size(struct z_heap *h, int bidx)
+{
+	int fl = bidx >> SL_LOG2;
+	uint32_t sl = SL_COUNT + (bidx & (SL_COUNT - 1));
+	uint32_t usable_sz = (fl >= SL_LOG2) ? (sl << (fl - SL_LOG2))
+					     : (sl >> (SL_LOG2 - fl));
+
+	return usable_sz - 1 + min_chunk_size(h);
+}
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+	return (h->sl_avail[bidx >> SL_LOG2] & BIT(bidx & (SL_COUNT - 1))) != 0;
+}
+
+static inline void set_bucket_avail(struct z_heap *h, int bidx, bool avail)
+{
+	int fl = bidx >> SL_LOG2;
+
+	if (avail) {
+		h->sl_avail[fl] |= BIT(bidx & (SL_COUNT - 1));
+		h->avail_buckets |= BIT(fl);
+	} else {
+		h->sl_avail[fl] &= ~BIT(bidx & (SL_COUNT - 1));
+		if (h->sl_avail[fl] == 0U) {
+			h->avail_buckets &= ~BIT(fl);
+		}
+	}
+}
+#else
 static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 {
 	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
 	return 31 - __builtin_clz(usable_sz);
 }
 
+static inline chunksz_t bucket_min_size(struct z_heap *h, int bidx)
+{
+	return (1 << bidx) - 1 + min_chunk_size(h);
+}
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+	return (h->avail_buckets & BIT(bidx)) != 0;
+}
+
+static inline void set_bucket_avail(struct z_heap *h, int bidx, bool avail)
+{
+	if (avail) {
+		h->avail_buckets |= BIT(bidx);
+	} else {
+		h->avail_buckets &= ~BIT(bidx);
+	}
+}
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
@@ -17,6 +17,10 @@
 
 #include <zephyr/data/json.h>
 
+#ifdef CONFIG_JSON_LIBRARY_FAST_SCAN
+#include "json_scan.h"
+#endif
+
 struct json_obj_key_value {
 	const char *key;
 	size_t key_len;
@@ -94,7 +98,13 @@ static void *lexer_string(struct json_lexer *lex)
 	ignore(lex);
 
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+#ifdef CONFIG_JSON_LIBRARY_FAST_SCAN
+		/* Skip to the next byte the loop below has to look at */
+		lex->pos = (char *)json_scan_string(lex->pos, lex->end);
+#endif
+		chr = next(lex);
 
 		if (chr == '\0') {
 			emit(lex, JSON_TOK_ERROR);
@@ -244,6 +254,9 @@ static void *lexer_json(struct json_lexer *lex)
 			__fallthrough;
 		default:
 			if (isspace(chr) != 0) {
+#ifdef CONFIG_JSON_LIBRARY_FAST_SCAN
+				lex->pos = (char *)json_scan_space(lex->pos, lex->end);
+#endif
 				ignore(lex);
 				continue;
 			}
@@ -634,6 +647,91 @@ static int arr_data_parse(struct json_obj *obj, struct json_obj_token *val)
 	return -EINVAL;
 }
 
+static bool field_match(const struct json_obj_descr *descr,
+			const struct json_obj_key_value *kv)
+{
+	return kv->key_len == descr->field_name_len &&
+	       memcmp(kv->key, descr->field_name, descr->field_name_len) == 0;
+}
+
+static int field_find(const struct json_obj_descr *descr, size_t descr_len,
+		      const struct json_obj_key_value *kv,
+		      int64_t decoded_fields)
+{
+	for (size_t i = 0; i < descr_len; i++) {
+		/* Field has been decoded already, skip */
+		if (decoded_fields & ((int64_t)1 << i)) {
+			continue;
+		}
+
+		/* Check if it's the i-th field */
+		if (field_match(&descr[i], kv)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+#ifdef CONFIG_JSON_LIBRARY_KEY_HASH
+/* Enough for descriptors of up to 63 fields to stay half empty */
+#define KEY_HASH_SLOTS 128
+
+/* Open addressing table of descriptor index + 1, 0 marks an empty slot */
+struct key_hash {
+	uint8_t slot[KEY_HASH_SLOTS];
+};
+
+static uint32_t key_hash(const char *key, size_t len)
+{
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint8_t)key[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static void key_hash_init(struct key_hash *table,
+			  const struct json_obj_descr *descr, size_t descr_len)
+{
+	memset(table->slot, 0, sizeof(table->slot));
+
+	for (size_t i = 0; i < descr_len; i++) {
+		uint32_t s = key_hash(descr[i].field_name,
+				      descr[i].field_name_len);
+
+		while (table->slot[s % KEY_HASH_SLOTS] != 0U) {
+			s++;
+		}
+		table->slot[s % KEY_HASH_SLOTS] = i + 1;
+	}
+}
+
+/* Probing visits fields sharing a name in descriptor order, as the
+ * linear search does.
+ */
+static int key_hash_find(const struct key_hash *table,
+			 const struct json_obj_descr *descr,
+			 const struct json_obj_key_value *kv,
+			 int64_t decoded_fields)
+{
+	uint32_t s = key_hash(kv->key, kv->key_len);
+
+	for (; table->slot[s % KEY_HASH_SLOTS] != 0U; s++) {
+		size_t i = table->slot[s % KEY_HASH_SLOTS] - 1;
+
+		if ((decoded_fields & ((int64_t)1 << i)) == 0 &&
+		    field_match(&descr[i], kv)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+#endif /* CONFIG_JSON_LIBRARY_KEY_HASH */
+
 static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
 			 size_t descr_len, void *val)
 {
@@ -641,40 +739,43 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 	int64_t decoded_fields = 0;
 	size_t i;
 	int ret;
+#ifdef CONFIG_JSON_LIBRARY_KEY_HASH
+	struct key_hash table;
+	bool hashed = descr_len >= CONFIG_JSON_LIBRARY_KEY_HASH_MIN_FIELDS;
+
+	if (hashed) {
+		key_hash_init(&table, descr, descr_len);
+	}
+#endif
 
 	while (!obj_next(obj, &kv)) {
 		if (kv.value.type == JSON_TOK_OBJECT_END) {
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
-			void *decode_field = (char *)val + descr[i].offset;
-
-			/* Field has been decoded already, skip */
-			if (decoded_fields & ((int64_t)1 << i)) {
-				continue;
-			}
-
-			/* Check if it's the i-th field */
-			if (kv.key_len != descr[i].field_name_len) {
-				continue;
-			}
-
-			if (memcmp(kv.key, descr[i].field_name,
-				   descr[i].field_name_len)) {
-				continue;
-			}
+#ifdef CONFIG_JSON_LIBRARY_KEY_HASH
+		if (hashed) {
+			ret = key_hash_find(&table, descr, &kv, decoded_fields);
+		} else {
+			ret = field_find(descr, descr_len, &kv, decoded_fields);
+		}
+#else
+		ret = field_find(descr, descr_len, &kv, decoded_fields);
+#endif
+		if (ret < 0) {
+			continue;
+		}
 
-			/* Store the decoded value */
-			ret = decode_value(obj, &descr[i], &kv.value,
-					   decode_field, val);
-			if (ret < 0) {
-				return ret;
-			}
+		i = ret;
 
-			decoded_fields |= (int64_t)1<<i;
-			break;
+		/* Store the decoded value */
+		ret = decode_value(obj, &descr[i], &kv.value,
+				   (char *)val + descr[i].offset, val);
+		if (ret < 0) {
+			return ret;
 		}
+
+		decoded_fields |= (int64_t)1<<i;
 	}
 
 	return -EINVAL;
@@ -774,15 +875,23 @@ static int json_escape_internal(const char *str,
 	int ret = 0;
 
 	for (cur = str; ret == 0 && *cur; cur++) {
-		char escaped = escape_as(*cur);
+		const char *run = cur;
+		char bytes[2] = { '\\', 0 };
 
-		if (escaped) {
-			char bytes[2] = { '\\', escaped };
+		/* Append characters which need no escaping in one go */
+		while (*cur && !escape_as(*cur)) {
+			cur++;
+		}
 
-			ret = append_bytes(bytes, 2, data);
-		} else {
-			ret = append_bytes(cur, 1, data);
+		if (cur != run) {
+			ret = append_bytes(run, cur - run, data);
+			if (ret != 0 || !*cur) {
+				break;
+			}
 		}
+
+		bytes[1] = escape_as(*cur);
+		ret = append_bytes(bytes, 2, data);
 	}
 
 	return ret;
@@ -0,0 +1,167 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Block scanning helpers for the JSON lexers. They skip over the bytes
+ * which do not need to be looked at one by one: the inside of strings up
+ * to the next quote, backslash or NUL, and runs of whitespace. SSE2 and
+ * NEON compare 16 bytes at a time, other targets test a machine word at
+ * a time for string contents and fall back to a byte loop for whitespace.
+ */
+
+#ifndef ZEPHYR_LIB_OS_JSON_SCAN_H_
+#define ZEPHYR_LIB_OS_JSON_SCAN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(__ARM_NEON) && !defined(__SSE2__)
+/* Four bits per byte of a comparison result, set for matching bytes */
+static inline uint64_t json_scan_neon_mask(uint8x16_t match)
+{
+	uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(match), 4);
+
+	return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+}
+#endif
+
+/* Repeat a byte over a word */
+#define JSON_SCAN_REPEAT(c) ((~(uintptr_t)0 / 0xff) * (uint8_t)(c))
+
+/* Non zero if any byte of the word is zero */
+#define JSON_SCAN_HAS_ZERO(w) \
+	(((w) - JSON_SCAN_REPEAT(0x01)) & ~(w) & JSON_SCAN_REPEAT(0x80))
+
+/*
+ * Return the first quote, backslash or NUL in [pos, end), or end if
+ * there is none.
+ */
+static inline const char *json_scan_string(const char *pos, const char *end)
+{
+#if defined(__SSE2__)
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i bslash = _mm_set1_epi8('\\');
+	const __m128i zero = _mm_setzero_si128();
+
+	for (; end - pos >= 16; pos += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)pos);
+		__m128i match = _mm_or_si128(_mm_cmpeq_epi8(v, quote),
+					     _mm_cmpeq_epi8(v, bslash));
+		int mask = _mm_movemask_epi8(_mm_or_si128(match,
+							  _mm_cmpeq_epi8(v, zero)));
+
+		if (mask != 0) {
+			return pos + __builtin_ctz(mask);
+		}
+	}
+#elif defined(__ARM_NEON)
+	const uint8x16_t quote = vdupq_n_u8('"');
+	const uint8x16_t bslash = vdupq_n_u8('\\');
+	const uint8x16_t zero = vdupq_n_u8(0);
+
+	for (; end - pos >= 16; pos += 16) {
+		uint8x16_t v = vld1q_u8((const uint8_t *)pos);
+		uint8x16_t match = vorrq_u8(vceqq_u8(v, quote),
+					    vceqq_u8(v, bslash));
+		uint64_t mask = json_scan_neon_mask(vorrq_u8(match, vceqq_u8(v, zero)));
+
+		if (mask != 0U) {
+			return pos + (__builtin_ctzll(mask) >> 2);
+		}
+	}
+#else
+	for (; end - pos >= (ptrdiff_t)sizeof(uintptr_t); pos += sizeof(uintptr_t)) {
+		uintptr_t w;
+
+		memcpy(&w, pos, sizeof(w));
+
+		if ((JSON_SCAN_HAS_ZERO(w) |
+		     JSON_SCAN_HAS_ZERO(w ^ JSON_SCAN_REPEAT('"')) |
+		     JSON_SCAN_HAS_ZERO(w ^ JSON_SCAN_REPEAT('\\'))) != 0U) {
+			break;
+		}
+	}
+#endif
+
+	for (; pos < end; pos++) {
+		if (*pos == '"' || *pos == '\\' || *pos == '\0') {
+			break;
+		}
+	}
+
+	return pos;
+}
+
+static inline bool json_scan_is_space(char chr)
+{
+	return chr == ' ' || chr == '\n' || chr == '\r' || chr == '\t';
+}
+
+/*
+ * Return the first byte in [pos, end) which is not a space, tab, CR or
+ * LF, or end if there is none.
+ */
+static inline const char *json_scan_space(const char *pos, const char *end)
+{
+#if defined(__SSE2__)
+	const __m128i sp = _mm_set1_epi8(' ');
+	const __m128i nl = _mm_set1_epi8('\n');
+	const __m128i cr = _mm_set1_epi8('\r');
+	const __m128i tab = _mm_set1_epi8('\t');
+
+	/* Most runs are short, only go wide for indentation */
+	while (end - pos >= 16 && json_scan_is_space(pos[0]) &&
+	       json_scan_is_space(pos[1])) {
+		__m128i v = _mm_loadu_si128((const __m128i *)pos);
+		__m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, sp),
+						       _mm_cmpeq_epi8(v, nl)),
+					  _mm_or_si128(_mm_cmpeq_epi8(v, cr),
+						       _mm_cmpeq_epi8(v, tab)));
+		int mask = ~_mm_movemask_epi8(ws) & 0xffff;
+
+		if (mask != 0) {
+			return pos + __builtin_ctz(mask);
+		}
+		pos += 16;
+	}
+#elif defined(__ARM_NEON)
+	const uint8x16_t sp = vdupq_n_u8(' ');
+	const uint8x16_t nl = vdupq_n_u8('\n');
+	const uint8x16_t cr = vdupq_n_u8('\r');
+	const uint8x16_t tab = vdupq_n_u8('\t');
+
+	while (end - pos >= 16 && json_scan_is_space(pos[0]) &&
+	       json_scan_is_space(pos[1])) {
+		uint8x16_t v = vld1q_u8((const uint8_t *)pos);
+		uint8x16_t ws = vorrq_u8(vorrq_u8(vceqq_u8(v, sp), vceqq_u8(v, nl)),
+					 vorrq_u8(vceqq_u8(v, cr), vceqq_u8(v, tab)));
+		uint64_t mask = ~json_scan_neon_mask(ws);
+
+		if (mask != 0U) {
+			return pos + (__builtin_ctzll(mask) >> 2);
+		}
+		pos += 16;
+	}
+#endif
+
+	for (; pos < end; pos++) {
+		if (!json_scan_is_space(*pos)) {
+			break;
+		}
+	}
+
+	return pos;
+}
+
+#endif /* ZEPHYR_LIB_OS_JSON_SCAN_H_ */
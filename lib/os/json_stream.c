@@ -0,0 +1,410 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/data/json.h>
+
+#if defined(CONFIG_NET_BUF)
+#include <zephyr/net/buf.h>
+#endif
+
+#include "json_scan.h"
+
+/* What the parser accepts next */
+enum stream_state {
+	EXPECT_VALUE,
+	/* Value or ']' right after '[' */
+	EXPECT_VALUE_OR_END,
+	EXPECT_KEY,
+	/* Key or '}' right after '{' */
+	EXPECT_KEY_OR_END,
+	EXPECT_COLON,
+	/* ',' or a closing bracket after a value */
+	EXPECT_NEXT,
+	/* The top level value is complete */
+	EXPECT_NOTHING,
+};
+
+/* Escape sequence state inside strings, 1 to 4 are hex digits left */
+#define ESCAPE_NONE	0
+#define ESCAPE_START	5
+
+/* One bit per nesting level in json_stream.nesting */
+#define MAX_DEPTH	32
+
+static int fail(struct json_stream *stream, int err)
+{
+	stream->error = err;
+
+	return err;
+}
+
+static bool in_object(const struct json_stream *stream)
+{
+	return (stream->depth > 0) &&
+	       (stream->nesting & BIT(stream->depth - 1)) != 0U;
+}
+
+/* State after a complete value */
+static enum stream_state value_done(const struct json_stream *stream)
+{
+	return (stream->depth == 0) ? EXPECT_NOTHING : EXPECT_NEXT;
+}
+
+static bool expect_value(const struct json_stream *stream)
+{
+	return stream->state == EXPECT_VALUE ||
+	       stream->state == EXPECT_VALUE_OR_END;
+}
+
+static int emit(struct json_stream *stream, enum json_tokens type,
+		const char *start, size_t len)
+{
+	int ret = stream->cb(type, start, len, stream->user_data);
+
+	if (ret != 0) {
+		return fail(stream, ret);
+	}
+
+	return 0;
+}
+
+static int buffer_append(struct json_stream *stream, const char *data,
+			 size_t len)
+{
+	if (len > stream->buf_size - stream->buf_len) {
+		return fail(stream, -ENOMEM);
+	}
+
+	memcpy(stream->buf + stream->buf_len, data, len);
+	stream->buf_len += len;
+
+	return 0;
+}
+
+static int emit_scalar(struct json_stream *stream, const char *start,
+		       size_t len)
+{
+	enum json_tokens type = stream->token;
+
+	if (type == JSON_TOK_NUMBER) {
+		/* Same rule as the in-memory lexer: '-' needs a digit */
+		if (start[0] == '-' && (len < 2 || isdigit((unsigned char)start[1]) == 0)) {
+			return fail(stream, -EINVAL);
+		}
+	} else if (type == JSON_TOK_TRUE) {
+		/* Tell literals apart now that they are complete */
+		if (len == 4 && memcmp(start, "true", 4) == 0) {
+			type = JSON_TOK_TRUE;
+		} else if (len == 5 && memcmp(start, "false", 5) == 0) {
+			type = JSON_TOK_FALSE;
+		} else if (len == 4 && memcmp(start, "null", 4) == 0) {
+			type = JSON_TOK_NULL;
+		} else {
+			return fail(stream, -EINVAL);
+		}
+	}
+
+	return emit(stream, type, start, len);
+}
+
+/*
+ * Advance *pos to the end of the token being scanned.
+ *
+ * @retval 1       Token complete, *pos is its end
+ * @retval 0       Token continues past the end of this fragment
+ * @retval -EINVAL Invalid token
+ */
+static int scan_token(struct json_stream *stream, const char **pos,
+		      const char *end)
+{
+	const char *p = *pos;
+
+	if (stream->token != JSON_TOK_STRING) {
+		/* Numbers and literals end at the first foreign byte, a
+		 * number may only have a '-' as its very first byte.
+		 */
+		if (stream->token == JSON_TOK_NUMBER && p < end && *p == '-' &&
+		    stream->buf_len == 0) {
+			p++;
+		}
+
+		for (; p < end; p++) {
+			if ((stream->token == JSON_TOK_NUMBER) ?
+			    (isdigit((unsigned char)*p) == 0 && *p != '.') :
+			    (islower((unsigned char)*p) == 0)) {
+				break;
+			}
+		}
+
+		*pos = p;
+		return (p < end) ? 1 : 0;
+	}
+
+	while (p < end) {
+		if (stream->escape == ESCAPE_START) {
+			if (*p == 'u') {
+				stream->escape = 4;
+			} else if (strchr("\"\\/bfnrt", *p) != NULL && *p != '\0') {
+				stream->escape = ESCAPE_NONE;
+			} else {
+				return -EINVAL;
+			}
+			p++;
+			continue;
+		}
+
+		if (stream->escape != ESCAPE_NONE) {
+			if (isxdigit((unsigned char)*p) == 0) {
+				return -EINVAL;
+			}
+			stream->escape--;
+			p++;
+			continue;
+		}
+
+		p = json_scan_string(p, end);
+		if (p == end) {
+			break;
+		}
+
+		if (*p == '"') {
+			*pos = p;
+			return 1;
+		}
+
+		if (*p == '\0') {
+			return -EINVAL;
+		}
+
+		stream->escape = ESCAPE_START;
+		p++;
+	}
+
+	*pos = end;
+	return 0;
+}
+
+/* Continue the token in progress, which started at start */
+static int feed_token(struct json_stream *stream, const char **pos,
+		      const char *end, const char *start)
+{
+	int ret = scan_token(stream, pos, end);
+
+	if (ret < 0) {
+		return fail(stream, ret);
+	}
+
+	if (ret == 0) {
+		/* Keep what we have for the next fragment */
+		return buffer_append(stream, start, end - start);
+	}
+
+	if (stream->buf_len == 0) {
+		/* Whole token is in this fragment, no copy needed */
+		ret = emit_scalar(stream, start, *pos - start);
+	} else {
+		ret = buffer_append(stream, start, *pos - start);
+		if (ret == 0) {
+			ret = emit_scalar(stream, stream->buf, stream->buf_len);
+		}
+		stream->buf_len = 0;
+	}
+
+	if (stream->token == JSON_TOK_STRING) {
+		/* Step over the closing quote */
+		(*pos)++;
+	}
+	stream->token = JSON_TOK_NONE;
+
+	return ret;
+}
+
+static int open_nesting(struct json_stream *stream, bool object)
+{
+	if (!expect_value(stream) || stream->depth == MAX_DEPTH) {
+		return fail(stream, -EINVAL);
+	}
+
+	WRITE_BIT(stream->nesting, stream->depth, object);
+	stream->depth++;
+	stream->state = object ? EXPECT_KEY_OR_END : EXPECT_VALUE_OR_END;
+
+	return emit(stream, object ? JSON_TOK_OBJECT_START : JSON_TOK_ARRAY_START,
+		    NULL, 0);
+}
+
+static int close_nesting(struct json_stream *stream, bool object)
+{
+	enum stream_state first = object ? EXPECT_KEY_OR_END : EXPECT_VALUE_OR_END;
+
+	if (stream->depth == 0 || in_object(stream) != object ||
+	    (stream->state != first && stream->state != EXPECT_NEXT)) {
+		return fail(stream, -EINVAL);
+	}
+
+	stream->depth--;
+	stream->state = value_done(stream);
+
+	return emit(stream, object ? JSON_TOK_OBJECT_END : JSON_TOK_ARRAY_END,
+		    NULL, 0);
+}
+
+/* Start a string, number or literal, and set the state that follows it */
+static int start_token(struct json_stream *stream, char chr)
+{
+	if (chr == '"') {
+		stream->token = JSON_TOK_STRING;
+		if (stream->state == EXPECT_KEY ||
+		    stream->state == EXPECT_KEY_OR_END) {
+			stream->state = EXPECT_COLON;
+			return 0;
+		}
+	} else if (isdigit((unsigned char)chr) != 0 || chr == '-') {
+		stream->token = JSON_TOK_NUMBER;
+	} else if (chr == 't' || chr == 'f' || chr == 'n') {
+		/* Resolved to the right literal once complete */
+		stream->token = JSON_TOK_TRUE;
+	} else {
+		return fail(stream, -EINVAL);
+	}
+
+	if (!expect_value(stream)) {
+		return fail(stream, -EINVAL);
+	}
+
+	stream->state = value_done(stream);
+
+	return 0;
+}
+
+int json_stream_init(struct json_stream *stream, char *buf, size_t buf_size,
+		     json_stream_cb_t cb, void *user_data)
+{
+	if (cb == NULL || (buf == NULL && buf_size > 0)) {
+		return -EINVAL;
+	}
+
+	*stream = (struct json_stream) {
+		.cb = cb,
+		.user_data = user_data,
+		.buf = buf,
+		.buf_size = buf_size,
+		.state = EXPECT_VALUE,
+		.token = JSON_TOK_NONE,
+	};
+
+	return 0;
+}
+
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len)
+{
+	const char *pos = data;
+	const char *end = data + len;
+	int ret = 0;
+
+	if (stream->error != 0) {
+		return stream->error;
+	}
+
+	if (stream->token != JSON_TOK_NONE) {
+		ret = feed_token(stream, &pos, end, pos);
+	}
+
+	while (ret == 0 && pos < end) {
+		char chr;
+
+		pos = json_scan_space(pos, end);
+		if (pos == end) {
+			break;
+		}
+
+		chr = *pos++;
+
+		switch (chr) {
+		case '{':
+		case '[':
+			ret = open_nesting(stream, chr == '{');
+			break;
+		case '}':
+		case ']':
+			ret = close_nesting(stream, chr == '}');
+			break;
+		case ':':
+			if (stream->state != EXPECT_COLON) {
+				return fail(stream, -EINVAL);
+			}
+			stream->state = EXPECT_VALUE;
+			ret = emit(stream, JSON_TOK_COLON, NULL, 0);
+			break;
+		case ',':
+			if (stream->state != EXPECT_NEXT) {
+				return fail(stream, -EINVAL);
+			}
+			stream->state = in_object(stream) ? EXPECT_KEY : EXPECT_VALUE;
+			ret = emit(stream, JSON_TOK_COMMA, NULL, 0);
+			break;
+		default:
+			ret = start_token(stream, chr);
+			if (ret == 0) {
+				/* Strings start after the quote, others at chr */
+				if (chr != '"') {
+					pos--;
+				}
+				ret = feed_token(stream, &pos, end, pos);
+			}
+			break;
+		}
+	}
+
+	return ret;
+}
+
+#if defined(CONFIG_NET_BUF)
+int json_stream_feed_net_buf(struct json_stream *stream,
+			     const struct net_buf *buf)
+{
+	int ret = 0;
+
+	for (; buf != NULL && ret == 0; buf = buf->frags) {
+		ret = json_stream_feed(stream, (const char *)buf->data, buf->len);
+	}
+
+	return ret;
+}
+#endif
+
+int json_stream_finish(struct json_stream *stream)
+{
+	int ret;
+
+	if (stream->error != 0) {
+		return stream->error;
+	}
+
+	if (stream->token == JSON_TOK_STRING) {
+		return fail(stream, -EINVAL);
+	}
+
+	if (stream->token != JSON_TOK_NONE) {
+		/* A number or literal at the very end has nothing after it */
+		ret = emit_scalar(stream, stream->buf, stream->buf_len);
+		stream->buf_len = 0;
+		stream->token = JSON_TOK_NONE;
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	if (stream->state != EXPECT_NOTHING) {
+		return fail(stream, -EINVAL);
+	}
+
+	return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* The page frames form a ring with a hand pointing at the next candidate.
+ * On each eviction the hand sweeps forward, clearing the accessed bit of
+ * every evictable page frame it passes, and stops at the first one that
+ * was not accessed since the hand last went by. This approximates LRU
+ * without the periodic timer and full page frame scans NRU needs.
+ *
+ * Clean page frames are preferred: a not accessed, dirty page frame is
+ * only remembered and taken if a full revolution finds nothing better.
+ */
+static unsigned int clock_hand;
+
+static inline struct z_page_frame *clock_advance(void)
+{
+	struct z_page_frame *pf = &z_page_frames[clock_hand];
+
+	clock_hand++;
+	if (clock_hand == Z_NUM_PAGE_FRAMES) {
+		clock_hand = 0U;
+	}
+
+	return pf;
+}
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf, *dirty_pf = NULL;
+	unsigned int dirty_hand = 0U;
+	uintptr_t flags;
+
+	/* First revolution clears accessed bits; the second one is then
+	 * guaranteed to find a not accessed page frame, if any is evictable.
+	 */
+	for (unsigned int i = 0U; i < 2U * Z_NUM_PAGE_FRAMES; i++) {
+		pf = clock_advance();
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			/* Second chance */
+			continue;
+		}
+
+		if ((flags & ARCH_DATA_PAGE_DIRTY) == 0UL) {
+			*dirty_ptr = false;
+			return pf;
+		}
+
+		if (dirty_pf == NULL) {
+			dirty_pf = pf;
+			dirty_hand = clock_hand;
+		}
+
+		if (i >= Z_NUM_PAGE_FRAMES) {
+			/* Every evictable page frame has been looked at with
+			 * its accessed bit cleared, settle for a dirty one.
+			 */
+			break;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(dirty_pf != NULL, "no page to evict");
+
+	/* Resume right after the page frame being evicted */
+	clock_hand = dirty_hand;
+	*dirty_ptr = true;
+
+	return dirty_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	clock_hand = 0U;
+}
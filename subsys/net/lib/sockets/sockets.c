@@ -1623,6 +1623,11 @@ int zsock_poll_internal(struct zsock_pollfd *fds, int nfds, k_timeout_t timeout)
 	bool offload = false;
 	const struct fd_op_vtable *offl_vtable = NULL;
 	void *offl_ctx = NULL;
+#ifdef CONFIG_NET_SOCKETS_POLL_SET
+	struct k_poll_set poll_set;
+	struct k_poll_event *ready[CONFIG_NET_SOCKETS_POLL_MAX];
+	int num_events;
+#endif
 
 	end = sys_clock_timeout_end_calc(timeout);
 
@@ -1699,12 +1704,29 @@ int zsock_poll_internal(struct zsock_pollfd *fds, int nfds, k_timeout_t timeout)
 
 	timeout_recalc(end, &timeout);
 
+#ifdef CONFIG_NET_SOCKETS_POLL_SET
+	/* Registered once, so that retries only visit signaled events */
+	num_events = pev - poll_events;
+	k_poll_set_init(&poll_set);
+	for (i = 0; i < num_events; i++) {
+		k_poll_set_add(&poll_set, &poll_events[i]);
+	}
+#endif
+
 	do {
+#ifdef CONFIG_NET_SOCKETS_POLL_SET
+		/* A poll set only updates the state of signaled events */
+		ret = k_poll_set_wait(&poll_set, ready, ARRAY_SIZE(ready),
+				      timeout);
+		ret = (ret > 0) ? 0 : ret;
+#else
 		ret = k_poll(poll_events, pev - poll_events, timeout);
+#endif
 		/* EAGAIN when timeout expired, EINTR when cancelled (i.e. EOF) */
 		if (ret != 0 && ret != -EAGAIN && ret != -EINTR) {
 			errno = -ret;
-			return -1;
+			ret = -1;
+			break;
 		}
 
 		retry = false;
@@ -1743,7 +1765,9 @@ int zsock_poll_internal(struct zsock_pollfd *fds, int nfds, k_timeout_t timeout)
 				continue;
 			} else if (result != 0) {
 				errno = -result;
-				return -1;
+				ret = -1;
+				retry = false;
+				break;
 			}
 
 			if (pfd->revents != 0) {
@@ -1764,6 +1788,12 @@ int zsock_poll_internal(struct zsock_pollfd *fds, int nfds, k_timeout_t timeout)
 		}
 	} while (retry);
 
+#ifdef CONFIG_NET_SOCKETS_POLL_SET
+	for (i = 0; i < num_events; i++) {
+		(void)k_poll_set_remove(&poll_set, &poll_events[i]);
+	}
+#endif
+
 	return ret;
 }
 
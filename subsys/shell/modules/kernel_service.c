@@ -22,6 +22,9 @@
 #if defined(CONFIG_LOG_RUNTIME_FILTERING)
 #include <zephyr/logging/log_ctrl.h>
 #endif
+#if defined(CONFIG_BOOT_PROFILER)
+#include <zephyr/debug/boot_profiler.h>
+#endif
 
 #if defined(CONFIG_THREAD_MAX_NAME_LEN)
 #define THREAD_MAX_NAM_LEN CONFIG_THREAD_MAX_NAME_LEN
@@ -244,6 +247,66 @@ static int cmd_kernel_stacks(const struct shell *sh,
 }
 #endif
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAM) && defined(CONFIG_THREAD_MONITOR)
+/* Print the non-empty buckets of one histogram on a single line */
+static void shell_hist_print(const struct shell *sh, const char *name,
+			     const uint32_t *buckets)
+{
+	shell_fprintf(sh, SHELL_NORMAL, "\t%-8s", name);
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS; i++) {
+		if (buckets[i] != 0U) {
+			shell_fprintf(sh, SHELL_NORMAL, " 2^%d:%u", i, buckets[i]);
+		}
+	}
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
+}
+
+static void shell_thread_hist_dump(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	struct k_cycle_histogram hist;
+	const char *tname;
+
+	if (k_thread_runtime_histogram_get(thread, &hist) != 0) {
+		return;
+	}
+
+	tname = k_thread_name_get(thread);
+
+	shell_print(sh, "%p %s", thread, tname ? tname : "NA");
+	shell_hist_print(sh, "latency:", hist.latency);
+	shell_hist_print(sh, "slice:", hist.slice);
+}
+
+static int cmd_kernel_sched_hist(const struct shell *sh,
+				 size_t argc, char **argv)
+{
+	struct k_cycle_histogram hist;
+	unsigned int num_cpus = arch_num_cpus();
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "Wakeup latency and run slice histograms, in cycles:");
+
+	for (int i = 0; i < num_cpus; i++) {
+		if (k_cpu_runtime_histogram_get(i, &hist) == 0) {
+			shell_print(sh, "CPU %d", i);
+			shell_hist_print(sh, "latency:", hist.latency);
+			shell_hist_print(sh, "slice:", hist.slice);
+		}
+	}
+
+#ifdef CONFIG_SMP
+	k_thread_foreach_unlocked(shell_thread_hist_dump, (void *)sh);
+#else
+	k_thread_foreach(shell_thread_hist_dump, (void *)sh);
+#endif
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 extern struct sys_heap _system_heap;
 
@@ -358,7 +421,39 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_reboot,
 );
 #endif
 
+#if defined(CONFIG_BOOT_PROFILER)
+static int cmd_kernel_boot_profile(const struct shell *sh,
+				   size_t argc, char **argv)
+{
+	const struct boot_profiler_record *recs;
+	size_t count, dropped;
+	char line[BOOT_PROFILER_LINE_LEN];
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	count = boot_profiler_records_get(&recs, &dropped);
+
+	(void)boot_profiler_record_format(NULL, line, sizeof(line));
+	shell_print(sh, "%s", line);
+	for (size_t i = 0; i < count; i++) {
+		(void)boot_profiler_record_format(&recs[i], line, sizeof(line));
+		shell_print(sh, "%s", line);
+	}
+
+	if (dropped != 0) {
+		shell_warn(sh, "%zu records dropped", dropped);
+	}
+
+	return 0;
+}
+#endif
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
+#if defined(CONFIG_BOOT_PROFILER)
+	SHELL_CMD(boot-profile, NULL, "Init levels and entries timing.",
+		  cmd_kernel_boot_profile),
+#endif
 	SHELL_CMD(cycles, NULL, "Kernel cycles.", cmd_kernel_cycles),
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
@@ -370,6 +465,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 #endif
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 	SHELL_CMD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap),
+#endif
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAM) && defined(CONFIG_THREAD_MONITOR)
+	SHELL_CMD(sched-hist, NULL, "Thread and CPU scheduling histograms.",
+		  cmd_kernel_sched_hist),
 #endif
 	SHELL_CMD(uptime, NULL, "Kernel uptime.", cmd_kernel_uptime),
 	SHELL_CMD(version, NULL, "Kernel version.", cmd_kernel_version),
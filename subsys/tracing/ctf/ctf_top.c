@@ -319,3 +319,21 @@ void sys_trace_k_timer_status_sync_exit(struct k_timer *timer, uint32_t result)
 		result
 		);
 }
+
+/* System init */
+void sys_trace_sys_init_enter(const struct init_entry *entry, int level)
+{
+	ctf_top_sys_init_enter(
+		(uint32_t)(uintptr_t)entry,
+		(uint32_t)level
+		);
+}
+
+void sys_trace_sys_init_exit(const struct init_entry *entry, int level, int result)
+{
+	ctf_top_sys_init_exit(
+		(uint32_t)(uintptr_t)entry,
+		(uint32_t)level,
+		(int32_t)result
+		);
+}
@@ -102,7 +102,9 @@ typedef enum {
 	CTF_EVENT_TIMER_STOP = 0x30,
 	CTF_EVENT_TIMER_STATUS_SYNC_ENTER = 0x31,
 	CTF_EVENT_TIMER_STATUS_SYNC_BLOCKING = 0x32,
-	CTF_EVENT_TIMER_STATUS_SYNC_EXIT = 0x33
+	CTF_EVENT_TIMER_STATUS_SYNC_EXIT = 0x33,
+	CTF_EVENT_SYS_INIT_ENTER = 0x34,
+	CTF_EVENT_SYS_INIT_EXIT = 0x35
 
 } ctf_event_t;
 
@@ -328,5 +330,16 @@ static inline void ctf_top_timer_status_sync_exit(uint32_t timer, uint32_t resul
 	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_TIMER_STATUS_SYNC_EXIT), timer, result);
 }
 
+/* System init */
+static inline void ctf_top_sys_init_enter(uint32_t entry, uint32_t level)
+{
+	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_SYS_INIT_ENTER), entry, level);
+}
+
+static inline void ctf_top_sys_init_exit(uint32_t entry, uint32_t level, int32_t result)
+{
+	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_SYS_INIT_EXIT), entry, level, result);
+}
+
 
 #endif /* SUBSYS_DEBUG_TRACING_CTF_TOP_H */
@@ -333,6 +333,11 @@ extern "C" {
 #define sys_port_trace_k_thread_resume_exit(thread)
 
 
+#define sys_port_trace_sys_init_enter(entry, level)                            \
+	sys_trace_sys_init_enter(entry, level)
+#define sys_port_trace_sys_init_exit(entry, level, result)                     \
+	sys_trace_sys_init_exit(entry, level, result)
+
 #define sys_port_trace_pm_system_suspend_enter(ticks)
 #define sys_port_trace_pm_system_suspend_exit(ticks, state)
 
@@ -436,6 +441,10 @@ void sys_trace_k_timer_status_sync_exit(struct k_timer *timer, uint32_t result);
 
 void sys_trace_k_event_init(struct k_event *event);
 
+/* System init */
+void sys_trace_sys_init_enter(const struct init_entry *entry, int level);
+void sys_trace_sys_init_exit(const struct init_entry *entry, int level, int result);
+
 #ifdef __cplusplus
 }
 #endif
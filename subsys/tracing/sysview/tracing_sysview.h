@@ -625,6 +625,12 @@ void sys_trace_k_thread_ready(struct k_thread *thread);
 void sys_trace_k_thread_pend(struct k_thread *thread);
 void sys_trace_k_thread_info(struct k_thread *thread);
 
+#define sys_port_trace_sys_init_enter(entry, level)			       \
+	SEGGER_SYSVIEW_RecordU32x2(TID_SYS_INIT,			       \
+				   (uint32_t)(uintptr_t)entry, (uint32_t)level)
+#define sys_port_trace_sys_init_exit(entry, level, result)		       \
+	SEGGER_SYSVIEW_RecordEndCallU32(TID_SYS_INIT, (uint32_t)result)
+
 #define sys_port_trace_pm_system_suspend_enter(ticks)			       \
 	SEGGER_SYSVIEW_RecordU32(TID_PM_SYSTEM_SUSPEND, (uint32_t)ticks)
 #define sys_port_trace_pm_system_suspend_exit(ticks, state)		       \
@@ -154,7 +154,9 @@ extern "C" {
 
 #define TID_SYSCALL (130u + TID_OFFSET)
 
-/* latest ID is 130 */
+#define TID_SYS_INIT (131u + TID_OFFSET)
+
+/* latest ID is 131 */
 
 #ifdef __cplusplus
 }
@@ -523,3 +523,13 @@ void sys_trace_k_thread_foreach_unlocked_exit(k_thread_user_cb_t user_cb, void *
 {
 	TRACING_STRING("%s: %p (%p) exit\n", __func__, user_cb, data);
 }
+
+void sys_trace_sys_init_enter(const struct init_entry *entry, int level)
+{
+	TRACING_STRING("%s: %p (%d) enter\n", __func__, entry, level);
+}
+
+void sys_trace_sys_init_exit(const struct init_entry *entry, int level, int result)
+{
+	TRACING_STRING("%s: %p (%d) exit %d\n", __func__, entry, level, result);
+}
@@ -29,6 +29,8 @@ void sys_trace_thread_pend_user(struct k_thread *thread);
 void sys_trace_isr_enter_user(int nested_interrupts);
 void sys_trace_isr_exit_user(int nested_interrupts);
 void sys_trace_idle_user(void);
+void sys_trace_sys_init_enter_user(const struct init_entry *entry, int level);
+void sys_trace_sys_init_exit_user(const struct init_entry *entry, int level, int result);
 
 void sys_trace_thread_create(struct k_thread *thread);
 void sys_trace_thread_abort(struct k_thread *thread);
@@ -44,6 +46,8 @@ void sys_trace_thread_pend(struct k_thread *thread);
 void sys_trace_isr_enter(void);
 void sys_trace_isr_exit(void);
 void sys_trace_idle(void);
+void sys_trace_sys_init_enter(const struct init_entry *entry, int level);
+void sys_trace_sys_init_exit(const struct init_entry *entry, int level, int result);
 
 #define sys_port_trace_k_thread_foreach_enter()
 #define sys_port_trace_k_thread_foreach_exit()
@@ -326,6 +330,10 @@ void sys_trace_idle(void);
 #define sys_port_trace_k_thread_abort_enter(thread)
 #define sys_port_trace_k_thread_resume_exit(thread)
 
+#define sys_port_trace_sys_init_enter(entry, level) sys_trace_sys_init_enter(entry, level)
+#define sys_port_trace_sys_init_exit(entry, level, result)                                         \
+	sys_trace_sys_init_exit(entry, level, result)
+
 #define sys_port_trace_pm_system_suspend_enter(ticks)
 #define sys_port_trace_pm_system_suspend_exit(ticks, state)
 
@@ -33,6 +33,11 @@
 /* flag for performing the Pipes benchmark */
 #define PIPE_BENCH
 
+/* flag for comparing in-place pipe access in the Pipes benchmark */
+#if defined(CONFIG_PIPES_CLAIM) && defined(CONFIG_POLL)
+#define PIPE_CLAIM_BENCH
+#endif
+
 /* flag for performing the Event benchmark */
 #define EVENT_BENCH
 
@@ -82,6 +82,9 @@
  */
 int pipeput(struct k_pipe *pipe, enum pipe_options
 		 option, int size, int count, uint32_t *time);
+#ifdef PIPE_CLAIM_BENCH
+int pipeput_claim(struct k_pipe *pipe, int size, int count, uint32_t *time);
+#endif
 
 /*
  * Function declarations.
@@ -102,6 +105,9 @@ void pipe_test(void)
 	uint32_t	TaskPrio = UINT32_MAX;
 	int		prio;
 	struct getinfo	getinfo;
+#ifdef PIPE_CLAIM_BENCH
+	uint32_t	claimtime[2];
+#endif
 
 	k_sem_reset(&SEM0);
 	k_sem_give(&STARTRCV);
@@ -177,6 +183,38 @@ void pipe_test(void)
 		PRINT_STRING(dashline, output_file);
 		k_thread_priority_set(k_current_get(), TaskPrio);
 	}
+
+#ifdef PIPE_CLAIM_BENCH
+	/* copying vs. in-place access, buffered pipes only */
+	PRINT_STRING("|              copy vs. in-place claims, "
+		     "matching sizes (_ALL_N)              |\n", output_file);
+	PRINT_STRING(dashline, output_file);
+	PRINT_STRING("| size(B) |      copy (nsec/packet)         |"
+		     "    in place (nsec/packet)       |\n", output_file);
+	PRINT_STRING(dashline, output_file);
+	PRINT_STRING("|         |   small buf    |    big buf     |"
+		     "   small buf    |    big buf     |\n", output_file);
+	PRINT_STRING(dashline, output_file);
+
+	for (putsize = 8U; putsize <= MESSAGE_SIZE_PIPE; putsize <<= 1) {
+		for (pipe = 1; pipe < 3; pipe++) {
+			pipeput(test_pipes[pipe], _ALL_N, putsize,
+				NR_OF_PIPE_RUNS, &puttime[pipe - 1]);
+			/* waiting for ack */
+			k_msgq_get(&CH_COMM, &getinfo, K_FOREVER);
+		}
+		for (pipe = 1; pipe < 3; pipe++) {
+			pipeput_claim(test_pipes[pipe], putsize,
+				      NR_OF_PIPE_RUNS, &claimtime[pipe - 1]);
+			/* waiting for ack */
+			k_msgq_get(&CH_COMM, &getinfo, K_FOREVER);
+		}
+		PRINT_F(output_file, "|%9u|%16u|%16u|%16u|%16u|\n",
+			putsize, puttime[0], puttime[1],
+			claimtime[0], claimtime[1]);
+	}
+	PRINT_STRING(dashline, output_file);
+#endif /* PIPE_CLAIM_BENCH */
 }
 
 
@@ -251,4 +289,72 @@ int pipeput(struct k_pipe *pipe,
 	return 0;
 }
 
+#ifdef PIPE_CLAIM_BENCH
+/**
+ *
+ * @brief Write a data portion to the pipe in place and measure time
+ *
+ * The data is written straight into the pipe buffer, and the receiver
+ * is woken once a whole data chunk (or the whole buffer) is available.
+ *
+ * @return 0 on success, 1 on error
+ *
+ * @param pipe     The pipe to be tested.
+ * @param size     Data chunk size.
+ * @param count    Number of data chunks.
+ * @param time     Total write time.
+ */
+int pipeput_claim(struct k_pipe *pipe, int size, int count, uint32_t *time)
+{
+	int i;
+	unsigned int t;
+	uint8_t *data;
+
+	(void)k_pipe_watermark_set(pipe, MIN((size_t)size, pipe->size));
+
+	/* first sync with the receiver */
+	k_sem_give(&SEM0);
+	t = BENCH_START();
+	for (i = 0; i < count; i++) {
+		size_t sizexferd = 0;
+
+		while (sizexferd < size) {
+			size_t claimed = k_pipe_put_claim(pipe, &data,
+							  size - sizexferd);
+
+			if (claimed == 0) {
+				/* full: let the receiver catch up */
+				k_yield();
+				continue;
+			}
+
+			(void)memcpy(data, &data_bench[sizexferd], claimed);
+			if (k_pipe_put_commit(pipe, claimed) != 0) {
+				return 1;
+			}
+			sizexferd += claimed;
+		}
+	}
+
+	t = TIME_STAMP_DELTA_GET(t);
+	*time = SYS_CLOCK_HW_CYCLES_TO_NS_AVG(t, count);
+	if (bench_test_end() < 0) {
+		if (high_timer_overflow()) {
+			PRINT_STRING("| Timer overflow."
+					"Results are invalid            ",
+						 output_file);
+		} else {
+	PRINT_STRING("| Tick occurred. Results may be inaccurate       ",
+						 output_file);
+		}
+		PRINT_STRING("                             |\n", output_file);
+	}
+
+	/* release any tail below the watermark */
+	(void)k_pipe_watermark_set(pipe, 0);
+
+	return 0;
+}
+#endif /* PIPE_CLAIM_BENCH */
+
 #endif /* PIPE_BENCH */
@@ -17,6 +17,10 @@
  */
 int pipeget(struct k_pipe *pipe, enum pipe_options option,
 			int size, int count, unsigned int *time);
+#ifdef PIPE_CLAIM_BENCH
+int pipeget_claim(struct k_pipe *pipe, int size, int count,
+		  unsigned int *time);
+#endif
 
 /*
  * Function declarations.
@@ -70,6 +74,28 @@ void piperecvtask(void)
 	}
 	}
 
+#ifdef PIPE_CLAIM_BENCH
+	/* copying vs. in-place access, buffered pipes only */
+	for (getsize = 8; getsize <= MESSAGE_SIZE_PIPE; getsize <<= 1) {
+		getcount = NR_OF_PIPE_RUNS;
+		getinfo.size = getsize;
+		getinfo.count = getcount;
+		for (pipe = 1; pipe < 3; pipe++) {
+			pipeget(test_pipes[pipe], _ALL_N, getsize,
+				getcount, &gettime);
+			getinfo.time = gettime;
+			/* acknowledge to master */
+			k_msgq_put(&CH_COMM, &getinfo, K_FOREVER);
+		}
+		for (pipe = 1; pipe < 3; pipe++) {
+			pipeget_claim(test_pipes[pipe], getsize,
+				      getcount, &gettime);
+			getinfo.time = gettime;
+			/* acknowledge to master */
+			k_msgq_put(&CH_COMM, &getinfo, K_FOREVER);
+		}
+	}
+#endif
 }
 
 
@@ -140,4 +166,70 @@ int pipeget(struct k_pipe *pipe, enum pipe_options option, int size, int count,
 	return 0;
 }
 
+#ifdef PIPE_CLAIM_BENCH
+/**
+ *
+ * @brief Read a data portion from the pipe in place and measure time
+ *
+ * The data is consumed straight from the pipe buffer, waiting for it
+ * with k_poll() when the pipe is empty.
+ *
+ * @return 0 on success, 1 on error
+ *
+ * @param pipe     Pipe to read data from.
+ * @param size     Data chunk size.
+ * @param count    Number of data chunks.
+ * @param time     Total read time.
+ */
+int pipeget_claim(struct k_pipe *pipe, int size, int count,
+		  unsigned int *time)
+{
+	unsigned int t;
+	struct k_poll_event event;
+	size_t sizexferd_total = 0;
+	size_t size2xfer_total = size * count;
+	uint8_t *data;
+
+	k_poll_event_init(&event, K_POLL_TYPE_PIPE_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, pipe);
+
+	/* sync with the sender */
+	k_sem_take(&SEM0, K_FOREVER);
+	t = BENCH_START();
+	while (sizexferd_total < size2xfer_total) {
+		size_t claimed = k_pipe_get_claim(pipe, &data,
+						  size2xfer_total -
+						  sizexferd_total);
+
+		if (claimed == 0) {
+			event.state = K_POLL_STATE_NOT_READY;
+			(void)k_poll(&event, 1, K_FOREVER);
+			continue;
+		}
+
+		if (k_pipe_get_finish(pipe, claimed) != 0) {
+			return 1;
+		}
+		sizexferd_total += claimed;
+	}
+
+	t = TIME_STAMP_DELTA_GET(t);
+	*time = SYS_CLOCK_HW_CYCLES_TO_NS_AVG(t, count);
+	if (bench_test_end() < 0) {
+		if (high_timer_overflow()) {
+			PRINT_STRING("| Timer overflow. "
+			"Results are invalid            ",
+						 output_file);
+		} else {
+			PRINT_STRING("| Tick occurred. "
+			"Results may be inaccurate       ",
+						 output_file);
+		}
+		PRINT_STRING("                             |\n",
+					 output_file);
+	}
+	return 0;
+}
+#endif /* PIPE_CLAIM_BENCH */
+
 #endif /* PIPE_BENCH */
@@ -0,0 +1,59 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_TESTS_BENCHMARKS_COMMON_SMP_BENCH_H_
+#define ZEPHYR_TESTS_BENCHMARKS_COMMON_SMP_BENCH_H_
+
+#include <zephyr/kernel.h>
+
+/*
+ * Worker threads for the SMP contention benchmarks. Each run starts a set
+ * of worker threads, waits for all of them to be ready, and lets them go
+ * at once, either for a fixed time or until they return by themselves.
+ */
+
+#define SMP_BENCH_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Largest number of workers in a run */
+#define SMP_BENCH_MAX_THREADS (2 * CONFIG_MP_MAX_NUM_CPUS)
+
+/**
+ * Body of a worker thread. It must call smp_bench_wait() once set up, and
+ * returns the number of operations it completed.
+ *
+ * @param id Index of the worker in the run, from 0.
+ * @param arg Argument given to smp_bench_run().
+ */
+typedef uint32_t (*smp_bench_worker_t)(unsigned int id, void *arg);
+
+/**
+ * Run @p n workers. With CONFIG_SCHED_CPU_MASK and no more workers than
+ * CPUs, worker i is pinned to CPU i.
+ *
+ * @param worker Body of the workers.
+ * @param arg Passed to every worker.
+ * @param n Number of workers, at most SMP_BENCH_MAX_THREADS.
+ * @param run_ms How long smp_bench_running() stays true, or 0 to wait for
+ *        the workers to return by themselves.
+ *
+ * @return Sum of the operations returned by the workers.
+ */
+uint32_t smp_bench_run(smp_bench_worker_t worker, void *arg, unsigned int n,
+		       int32_t run_ms);
+
+/** Report the calling worker as ready and wait for the run to start */
+void smp_bench_wait(void);
+
+/** Tell workers of a timed run whether to keep going */
+bool smp_bench_running(void);
+
+/** Operations returned by worker @p id in the last run */
+uint32_t smp_bench_ops(unsigned int id);
+
+/** Uptime in milliseconds at which the last run started */
+int64_t smp_bench_start_time(void);
+
+#endif /* ZEPHYR_TESTS_BENCHMARKS_COMMON_SMP_BENCH_H_ */
@@ -0,0 +1,99 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <smp_bench.h>
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, SMP_BENCH_MAX_THREADS,
+				   SMP_BENCH_STACK_SIZE);
+static struct k_thread worker_threads[SMP_BENCH_MAX_THREADS];
+
+static smp_bench_worker_t bench_worker;
+static uint32_t ops[SMP_BENCH_MAX_THREADS];
+static int64_t start_time;
+static atomic_t running;
+static atomic_t ready;
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	unsigned int id = POINTER_TO_UINT(p1);
+
+	ARG_UNUSED(p3);
+
+	ops[id] = bench_worker(id, p2);
+}
+
+uint32_t smp_bench_run(smp_bench_worker_t worker, void *arg, unsigned int n,
+		       int32_t run_ms)
+{
+	uint32_t total = 0U;
+
+	__ASSERT_NO_MSG(n <= SMP_BENCH_MAX_THREADS);
+
+	bench_worker = worker;
+	atomic_set(&ready, 0);
+
+	for (unsigned int i = 0; i < n; i++) {
+		ops[i] = 0U;
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				SMP_BENCH_STACK_SIZE, worker_entry,
+				UINT_TO_POINTER(i), arg, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		if (n <= arch_num_cpus()) {
+			k_thread_cpu_pin(&worker_threads[i], i);
+		}
+#endif
+		k_thread_start(&worker_threads[i]);
+	}
+
+	/* Sleep rather than spin, one of the workers shares our CPU */
+	while (atomic_get(&ready) != n) {
+		k_msleep(1);
+	}
+
+	start_time = k_uptime_get();
+	atomic_set(&running, 1);
+
+	if (run_ms > 0) {
+		k_msleep(run_ms);
+		atomic_set(&running, 0);
+	}
+
+	for (unsigned int i = 0; i < n; i++) {
+		k_thread_join(&worker_threads[i], K_FOREVER);
+		total += ops[i];
+	}
+
+	atomic_set(&running, 0);
+
+	return total;
+}
+
+void smp_bench_wait(void)
+{
+	atomic_inc(&ready);
+
+	/* Yield, there may be more workers than CPUs still to get ready */
+	while (atomic_get(&running) == 0) {
+		k_yield();
+	}
+}
+
+bool smp_bench_running(void)
+{
+	return atomic_get(&running) != 0;
+}
+
+uint32_t smp_bench_ops(unsigned int id)
+{
+	return ops[id];
+}
+
+int64_t smp_bench_start_time(void)
+{
+	return start_time;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief CRC throughput benchmark
+ *
+ * Checks the configured CRC-32 implementation against bit by bit
+ * reference implementations, then reports the throughput of the CRC
+ * functions in bytes per microsecond.
+ *
+ * @defgroup lib_crc_benchmark CRC benchmark
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/crc.h>
+
+#define BUF_SIZE 4096
+#define BENCH_ROUNDS 16
+
+static uint8_t buf[BUF_SIZE + 8];
+
+static uint32_t crc32_reflected_ref(uint32_t poly, uint32_t crc,
+				    const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+		for (int j = 0; j < 8; j++) {
+			crc = (crc >> 1) ^ ((crc & 1U) ? poly : 0U);
+		}
+	}
+
+	return crc;
+}
+
+static uint32_t crc32_ieee_ref(const uint8_t *data, size_t len)
+{
+	return ~crc32_reflected_ref(0xEDB88320U, ~0U, data, len);
+}
+
+static uint32_t crc32_c_ref(const uint8_t *data, size_t len)
+{
+	return ~crc32_reflected_ref(0x82F63B78U, ~0U, data, len);
+}
+
+static void *crc_setup(void)
+{
+	uint32_t x = 0x12345678U;
+
+	/* xorshift32, any non trivial pattern will do */
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		buf[i] = (uint8_t)x;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Check CRC-32 against the reference for all lengths and alignments
+ *
+ * Lengths up to 64 bytes and every alignment within 8 bytes exercise the
+ * head and tail handling of sliced and hardware implementations.
+ *
+ * @ingroup lib_crc_benchmark
+ */
+ZTEST(crc_bench, test_crc32_vs_reference)
+{
+	for (size_t offset = 0; offset < 8; offset++) {
+		for (size_t len = 0; len <= 64; len++) {
+			const uint8_t *data = buf + offset;
+
+			zassert_equal(crc32_ieee(data, len),
+				      crc32_ieee_ref(data, len),
+				      "crc32_ieee mismatch, offset %zu len %zu",
+				      offset, len);
+			zassert_equal(crc32_c(0, data, len, true, true),
+				      crc32_c_ref(data, len),
+				      "crc32_c mismatch, offset %zu len %zu",
+				      offset, len);
+		}
+	}
+
+	zassert_equal(crc32_ieee(buf, BUF_SIZE), crc32_ieee_ref(buf, BUF_SIZE));
+	zassert_equal(crc32_c(0, buf, BUF_SIZE, true, true),
+		      crc32_c_ref(buf, BUF_SIZE));
+}
+
+/**
+ * @brief Check that CRC-32 can be computed in chunks
+ *
+ * @ingroup lib_crc_benchmark
+ */
+ZTEST(crc_bench, test_crc32_chunked)
+{
+	uint32_t ieee = 0, c = 0;
+	size_t pos = 0;
+
+	for (size_t chunk = 1; pos + chunk <= BUF_SIZE; chunk = chunk * 3 + 1) {
+		ieee = crc32_ieee_update(ieee, buf + pos, chunk);
+		c = crc32_c(c, buf + pos, chunk, pos == 0, false);
+		pos += chunk;
+	}
+	ieee = crc32_ieee_update(ieee, buf + pos, BUF_SIZE - pos);
+	c = crc32_c(c, buf + pos, BUF_SIZE - pos, false, true);
+
+	zassert_equal(ieee, crc32_ieee_ref(buf, BUF_SIZE));
+	zassert_equal(c, crc32_c_ref(buf, BUF_SIZE));
+}
+
+static volatile uint32_t sink;
+
+static void report(const char *name, uint32_t (*fn)(const uint8_t *, size_t))
+{
+	uint32_t start, cycles;
+	uint64_t ns;
+
+	/* Warm up caches */
+	sink = fn(buf, BUF_SIZE);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		sink = fn(buf, BUF_SIZE);
+	}
+	cycles = k_cycle_get_32() - start;
+	ns = k_cyc_to_ns_ceil64(cycles);
+
+	TC_PRINT("%-14s %8u cycles for %u bytes, %llu bytes/ms\n", name, cycles,
+		 BENCH_ROUNDS * BUF_SIZE,
+		 ns ? (uint64_t)BENCH_ROUNDS * BUF_SIZE * 1000000U / ns : 0);
+}
+
+static uint32_t bench_crc32_ieee(const uint8_t *data, size_t len)
+{
+	return crc32_ieee(data, len);
+}
+
+static uint32_t bench_crc32_c(const uint8_t *data, size_t len)
+{
+	return crc32_c(0, data, len, true, true);
+}
+
+static uint32_t bench_crc32_ref(const uint8_t *data, size_t len)
+{
+	return crc32_ieee_ref(data, len);
+}
+
+static uint32_t bench_crc16_ccitt(const uint8_t *data, size_t len)
+{
+	return crc16_ccitt(0, data, len);
+}
+
+static uint32_t bench_crc8_ccitt(const uint8_t *data, size_t len)
+{
+	return crc8_ccitt(0, data, len);
+}
+
+/**
+ * @brief Report the throughput of the CRC functions
+ *
+ * The bit by bit CRC-32 reference is included as a baseline.
+ *
+ * @ingroup lib_crc_benchmark
+ */
+ZTEST(crc_bench, test_crc_throughput)
+{
+#if defined(CONFIG_CRC_HW)
+	TC_PRINT("CRC-32: CPU instructions where available, %d slices\n",
+		 CONFIG_CRC32_SLICES);
+#else
+	TC_PRINT("CRC-32: %d slices (0 is 4 bits per step)\n",
+		 CONFIG_CRC32_SLICES);
+#endif
+
+	report("crc32 bitwise", bench_crc32_ref);
+	report("crc32_ieee", bench_crc32_ieee);
+	report("crc32_c", bench_crc32_c);
+	report("crc16_ccitt", bench_crc16_ccitt);
+	report("crc8_ccitt", bench_crc8_ccitt);
+}
+
+ZTEST_SUITE(crc_bench, NULL, crc_setup, NULL, NULL, NULL);
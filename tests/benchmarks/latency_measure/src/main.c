@@ -28,6 +28,8 @@ extern int sema_test(void);
 extern int sema_context_switch(void);
 extern int suspend_resume(void);
 extern void heap_malloc_free(void);
+extern void timeout_add_abort(void);
+extern int user_syscall(void);
 
 void test_thread(void *arg1, void *arg2, void *arg3)
 {
@@ -60,6 +62,12 @@ void test_thread(void *arg1, void *arg2, void *arg3)
 
 	heap_malloc_free();
 
+	timeout_add_abort();
+
+#ifdef CONFIG_USERSPACE
+	user_syscall();
+#endif
+
 	TC_END_REPORT(error_count);
 }
 
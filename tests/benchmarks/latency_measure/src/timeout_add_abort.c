@@ -0,0 +1,69 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+/* number of timeouts kept outstanding while measuring */
+#define N_PENDING_TIMEOUTS 256
+
+/* number of k_timer start/stop cycles to average over */
+#define N_TEST_TIMER 100
+
+static struct k_timer pending_timers[N_PENDING_TIMEOUTS];
+static struct k_timer test_timer;
+
+/**
+ *
+ * @brief Measure the cost of arming and cancelling a timeout
+ *
+ * The routine arms N_PENDING_TIMEOUTS timers expiring at spread out
+ * points in the future, then measures the average time to start and
+ * stop one more timer expiring after all of them.  With the sorted
+ * list timeout queue this is the worst case, as starting the timer
+ * walks every pending timeout.
+ */
+void timeout_add_abort(void)
+{
+	uint32_t sum_start = 0U;
+	uint32_t sum_stop = 0U;
+	timing_t start;
+	timing_t end;
+	int i;
+
+	k_timer_init(&test_timer, NULL, NULL);
+
+	for (i = 0; i < N_PENDING_TIMEOUTS; i++) {
+		k_timer_init(&pending_timers[i], NULL, NULL);
+		k_timer_start(&pending_timers[i], K_SECONDS(1000 + i), K_NO_WAIT);
+	}
+
+	timing_start();
+
+	for (i = 0; i < N_TEST_TIMER; i++) {
+		start = timing_counter_get();
+		k_timer_start(&test_timer, K_SECONDS(2000), K_NO_WAIT);
+		end = timing_counter_get();
+		sum_start += timing_cycles_get(&start, &end);
+
+		start = timing_counter_get();
+		k_timer_stop(&test_timer);
+		end = timing_counter_get();
+		sum_stop += timing_cycles_get(&start, &end);
+	}
+
+	PRINT_STATS_AVG("Average time to arm a timeout (" STRINGIFY(N_PENDING_TIMEOUTS)
+			" pending)", sum_start, N_TEST_TIMER);
+	PRINT_STATS_AVG("Average time to cancel a timeout (" STRINGIFY(N_PENDING_TIMEOUTS)
+			" pending)", sum_stop, N_TEST_TIMER);
+
+	timing_stop();
+
+	for (i = 0; i < N_PENDING_TIMEOUTS; i++) {
+		k_timer_stop(&pending_timers[i]);
+	}
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for system calls made from user mode
+ *
+ * This file contains the test that measures how long a user thread takes
+ * to make a system call whose only argument check is a kernel object, and
+ * one that also checks a memory buffer.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+#ifdef CONFIG_USERSPACE
+
+/* the number of system calls of each kind */
+#define N_TEST_SYSCALL 1000
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+/* stack used by the user thread */
+static K_THREAD_STACK_DEFINE(user_thread_stack, STACK_SIZE);
+
+static struct k_thread user_thread_data;
+
+K_SEM_DEFINE(user_sync_sema, 0, 3);
+K_SEM_DEFINE(user_count_sema, 0, 1);
+K_MSGQ_DEFINE(user_msgq, sizeof(uint32_t), 1, sizeof(uint32_t));
+
+static void user_syscall_thread(void *p1, void *p2, void *p3)
+{
+	uint32_t msg;
+	int i;
+
+	k_sem_give(&user_sync_sema);
+
+	for (i = 0; i < N_TEST_SYSCALL; i++) {
+		(void)k_sem_count_get(&user_count_sema);
+	}
+
+	k_sem_give(&user_sync_sema);
+
+	for (i = 0; i < N_TEST_SYSCALL; i++) {
+		(void)k_msgq_peek(&user_msgq, &msg);
+	}
+
+	k_sem_give(&user_sync_sema);
+}
+
+/**
+ *
+ * @brief The function tests system call time from user mode
+ *
+ * A lower priority user thread makes batches of system calls, handing
+ * control back to this thread between batches so that each batch can be
+ * timed.
+ *
+ * @return 0 on success
+ */
+int user_syscall(void)
+{
+	uint32_t diff;
+	uint32_t msg = 0;
+	timing_t timestamp_start;
+	timing_t timestamp_end;
+
+	(void)k_msgq_put(&user_msgq, &msg, K_NO_WAIT);
+
+	timing_start();
+
+	k_thread_create(&user_thread_data, user_thread_stack,
+			STACK_SIZE, user_syscall_thread,
+			NULL, NULL, NULL,
+			K_PRIO_PREEMPT(11), K_USER, K_FOREVER);
+	k_object_access_grant(&user_sync_sema, &user_thread_data);
+	k_object_access_grant(&user_count_sema, &user_thread_data);
+	k_object_access_grant(&user_msgq, &user_thread_data);
+	k_thread_start(&user_thread_data);
+
+	k_sem_take(&user_sync_sema, K_FOREVER);
+	timestamp_start = timing_counter_get();
+
+	k_sem_take(&user_sync_sema, K_FOREVER);
+	timestamp_end = timing_counter_get();
+
+	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+	PRINT_STATS_AVG("Average time for a user syscall on a kernel object",
+			diff, N_TEST_SYSCALL);
+
+	timestamp_start = timing_counter_get();
+
+	k_sem_take(&user_sync_sema, K_FOREVER);
+	timestamp_end = timing_counter_get();
+
+	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+	PRINT_STATS_AVG("Average time for a user syscall on an object and buffer",
+			diff, N_TEST_SYSCALL);
+
+	k_thread_join(&user_thread_data, K_FOREVER);
+	timing_stop();
+
+	return 0;
+}
+
+#endif /* CONFIG_USERSPACE */
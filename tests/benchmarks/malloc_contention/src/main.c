@@ -0,0 +1,87 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <smp_bench.h>
+
+/* Blocks each thread keeps allocated at any time */
+#define LIVE_BLOCKS 8
+
+/* Range of request sizes */
+#define MIN_SIZE 8
+#define MAX_SIZE 256
+
+/* Duration of the measurement */
+#define RUN_MS 1000
+
+#define MAX_CPUS CONFIG_MP_MAX_NUM_CPUS
+
+static uint32_t failures[MAX_CPUS];
+
+/* Cheap per-thread PRNG, the libc one is not thread safe */
+static uint32_t xorshift32(uint32_t *state)
+{
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+
+	return x;
+}
+
+static uint32_t worker(unsigned int cpu, void *arg)
+{
+	void *blocks[LIVE_BLOCKS] = { NULL };
+	uint32_t seed = 0x9e3779b9U * (cpu + 1);
+	uint32_t count = 0U, failed = 0U;
+	unsigned int slot = 0U;
+
+	ARG_UNUSED(arg);
+
+	smp_bench_wait();
+
+	while (smp_bench_running()) {
+		size_t size = MIN_SIZE + xorshift32(&seed) % (MAX_SIZE - MIN_SIZE + 1);
+
+		k_free(blocks[slot]);
+		blocks[slot] = k_malloc(size);
+		if (blocks[slot] == NULL) {
+			failed++;
+		}
+		slot = (slot + 1U) % LIVE_BLOCKS;
+		count++;
+	}
+
+	for (slot = 0U; slot < LIVE_BLOCKS; slot++) {
+		k_free(blocks[slot]);
+	}
+
+	failures[cpu] = failed;
+
+	return count;
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint32_t total, failed = 0U;
+
+	printk("malloc contention: %u CPUs, %d live blocks per thread, %d ms\n",
+	       num_cpus, LIVE_BLOCKS, RUN_MS);
+
+	total = smp_bench_run(worker, NULL, num_cpus, RUN_MS);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		failed += failures[i];
+	}
+
+	printk("malloc: %u ops, %u failures\n", total, failed);
+
+	return 0;
+}
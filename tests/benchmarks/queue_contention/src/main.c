@@ -0,0 +1,93 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <smp_bench.h>
+
+/* Items circulating between the FIFOs */
+#define N_ITEMS 64
+
+/* Duration of each measurement */
+#define RUN_MS 1000
+
+/* How long a blocked thread waits before checking for the end of a run */
+#define POLL_MS 10
+
+struct item {
+	void *fifo_reserved;
+	uint32_t seq;
+};
+
+static struct item items[N_ITEMS];
+
+static K_FIFO_DEFINE(free_fifo);
+static K_FIFO_DEFINE(work_fifo);
+
+/* The first workers produce, moving items from the free FIFO to the work
+ * FIFO, and the others consume, moving them back.
+ */
+static uint32_t mover(unsigned int id, void *arg)
+{
+	unsigned int producers = *(unsigned int *)arg;
+	struct k_fifo *from = (id < producers) ? &free_fifo : &work_fifo;
+	struct k_fifo *to = (id < producers) ? &work_fifo : &free_fifo;
+	uint32_t count = 0U;
+
+	smp_bench_wait();
+
+	while (smp_bench_running()) {
+		struct item *item = k_fifo_get(from, K_MSEC(POLL_MS));
+
+		if (item == NULL) {
+			continue;
+		}
+		item->seq++;
+		k_fifo_put(to, item);
+		count++;
+	}
+
+	return count;
+}
+
+static uint32_t run(unsigned int producers, unsigned int consumers)
+{
+	unsigned int n = producers + consumers;
+	uint32_t total = 0U;
+	void *item;
+
+	/* Gather all items back on the free FIFO */
+	while ((item = k_fifo_get(&work_fifo, K_NO_WAIT)) != NULL) {
+		k_fifo_put(&free_fifo, item);
+	}
+
+	(void)smp_bench_run(mover, &producers, n, RUN_MS);
+
+	for (unsigned int i = producers; i < n; i++) {
+		total += smp_bench_ops(i);
+	}
+
+	return total;
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	printk("queue contention: %u CPUs, %d items, %d ms per shape\n",
+	       num_cpus, N_ITEMS, RUN_MS);
+
+	for (int i = 0; i < N_ITEMS; i++) {
+		k_fifo_put(&free_fifo, &items[i]);
+	}
+
+	printk("1 to %u: %u items\n", num_cpus, run(1, num_cpus));
+	printk("%u to 1: %u items\n", num_cpus, run(num_cpus, 1));
+	printk("%u to %u: %u items\n", num_cpus, num_cpus,
+	       run(num_cpus, num_cpus));
+
+	return 0;
+}
@@ -49,6 +49,10 @@ enum {
 
 uint32_t stamps[NUM_STAMP_STATES];
 
+#ifdef CONFIG_SMP
+extern void smp_switch_throughput(void);
+#endif
+
 static inline int _stamp(int state)
 {
 	uint32_t t;
@@ -148,6 +152,11 @@ int main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#ifdef CONFIG_SMP
+	smp_switch_throughput();
+#endif
+
 	printk("fin\n");
 	return 0;
 }
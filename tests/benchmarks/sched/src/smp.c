@@ -0,0 +1,94 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Context switch throughput with a varying number of CPUs.  For each
+ * core count N, two yielding workers per core compete at the same
+ * priority, while the remaining CPUs are kept busy by higher priority
+ * spinners so that the workers only ever run on N cores.  The number
+ * of k_yield() calls (each of which is a context switch, the other
+ * worker of the pair being runnable) per second is reported.
+ */
+
+#define RUN_MS 500
+#define MAX_CPUS CONFIG_MP_MAX_NUM_CPUS
+#define N_THREADS (3 * MAX_CPUS)
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#define SPINNER_PRIO K_PRIO_PREEMPT(1)
+#define WORKER_PRIO K_PRIO_PREEMPT(2)
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, N_THREADS, STACK_SIZE);
+static struct k_thread threads[N_THREADS];
+static uint32_t yields[N_THREADS];
+static atomic_t running;
+
+static void worker_fn(void *p1, void *p2, void *p3)
+{
+	uint32_t *count = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&running) != 0) {
+		k_yield();
+		(*count)++;
+	}
+}
+
+static void spinner_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&running) != 0) {
+		k_busy_wait(100);
+	}
+}
+
+static uint32_t run(unsigned int cores)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int n = 0;
+	uint64_t total = 0U;
+
+	atomic_set(&running, 1);
+
+	for (unsigned int i = cores; i < num_cpus; i++, n++) {
+		k_thread_create(&threads[n], stacks[n], STACK_SIZE,
+				spinner_fn, NULL, NULL, NULL,
+				SPINNER_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (unsigned int i = 0; i < 2 * cores; i++, n++) {
+		yields[n] = 0U;
+		k_thread_create(&threads[n], stacks[n], STACK_SIZE,
+				worker_fn, &yields[n], NULL, NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	k_msleep(RUN_MS);
+	atomic_set(&running, 0);
+
+	for (unsigned int i = 0; i < n; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		if (i >= (num_cpus - cores)) {
+			total += yields[i];
+		}
+	}
+
+	return (uint32_t)(total * MSEC_PER_SEC / RUN_MS);
+}
+
+void smp_switch_throughput(void)
+{
+	for (unsigned int cores = 1; cores <= arch_num_cpus(); cores++) {
+		printk("cpus %u: %u switches/s\n", cores, run(cores));
+	}
+}
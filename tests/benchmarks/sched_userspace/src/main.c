@@ -114,6 +114,61 @@ static int exec_test(uint8_t nb_threads)
 	return yielder_status;
 }
 
+#ifdef CONFIG_DYNAMIC_OBJECTS
+#define MAX_NB_DYN_OBJS 512
+
+static void *dyn_objs[MAX_NB_DYN_OBJS];
+
+static int exec_validate_test(size_t nb_objs)
+{
+	struct k_sem *target;
+	k_tid_t thread;
+	int ret = 0;
+	size_t i;
+
+	if (nb_objs == 0 || nb_objs > MAX_NB_DYN_OBJS) {
+		printk("Bad number of objects\n");
+		return 1;
+	}
+
+	for (i = 0; i < nb_objs; i++) {
+		dyn_objs[i] = k_object_alloc(K_OBJ_SEM);
+		if (dyn_objs[i] == NULL) {
+			printk("k_object_alloc failed after %zu objects\n", i);
+			ret = 1;
+			goto out;
+		}
+		k_sem_init(dyn_objs[i], 0, 1);
+	}
+
+	/* validate the most recently allocated object */
+	target = dyn_objs[nb_objs - 1];
+
+	thread = k_thread_create(&app_threads[0].thread, app_thread_stacks[0],
+				 APP_STACKSIZE, syscall_validate, target, NULL,
+				 NULL, THREADS_PRIO, K_USER, K_FOREVER);
+	k_object_access_grant(target, thread);
+
+	stamp(MEAS_START);
+	k_thread_start(thread);
+	k_thread_join(thread, K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time)/NB_SYSCALLS;
+
+	printk("Validating %4zu objects: %8" PRIu32 " cyc & %6" PRIu32 " calls -> %6"
+				PRIu64 " ns per call\n", nb_objs, full_time,
+				NB_SYSCALLS, time_ns);
+
+out:
+	while (i-- > 0) {
+		k_object_free(dyn_objs[i]);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_DYNAMIC_OBJECTS */
 
 int main(void)
 {
@@ -134,6 +189,21 @@ int main(void)
 		}
 	}
 
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	size_t nb_objs_list[] = {1, 64, 512, 0};
+
+	printk("============================\n");
+	printk("user syscall on a dynamic object\n");
+
+	for (size_t i = 0; nb_objs_list[i] > 0; i++) {
+		ret = exec_validate_test(nb_objs_list[i]);
+		if (ret != 0) {
+			printk("FAIL\n");
+			return 0;
+		}
+	}
+#endif
+
 	printk("SUCCESS\n");
 	return 0;
 }
@@ -5,5 +5,7 @@
  */
 
 #define NB_YIELDS UINT32_C(1000000)
+#define NB_SYSCALLS UINT32_C(100000)
 
 void context_switch_yield(void *p1, void *p2, void *p3);
+void syscall_validate(void *p1, void *p2, void *p3);
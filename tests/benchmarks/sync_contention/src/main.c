@@ -0,0 +1,83 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <smp_bench.h>
+
+/* Time spent holding the object on each acquisition */
+#define HOLD_US 2
+
+/* Duration of each measurement */
+#define RUN_MS 1000
+
+static K_MUTEX_DEFINE(test_mutex);
+static K_SEM_DEFINE(test_sem, 1, 1);
+
+static uint32_t mutex_worker(unsigned int cpu, void *arg)
+{
+	uint32_t count = 0U;
+
+	ARG_UNUSED(cpu);
+	ARG_UNUSED(arg);
+
+	smp_bench_wait();
+
+	while (smp_bench_running()) {
+		k_mutex_lock(&test_mutex, K_FOREVER);
+		k_busy_wait(HOLD_US);
+		k_mutex_unlock(&test_mutex);
+		count++;
+	}
+
+	return count;
+}
+
+static uint32_t sem_worker(unsigned int cpu, void *arg)
+{
+	uint32_t count = 0U;
+
+	ARG_UNUSED(cpu);
+	ARG_UNUSED(arg);
+
+	smp_bench_wait();
+
+	while (smp_bench_running()) {
+		k_sem_take(&test_sem, K_FOREVER);
+		k_busy_wait(HOLD_US);
+		k_sem_give(&test_sem);
+		count++;
+	}
+
+	return count;
+}
+
+static void report(const char *name, uint32_t total,
+		   const struct k_sync_contention_stats *stats)
+{
+	printk("%s: %u ops, %u contended, %u spun, %u pended\n", name, total,
+	       stats->contended, stats->spin_acquired, stats->pended);
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct k_sync_contention_stats stats;
+	uint32_t total;
+
+	printk("sync contention: %u CPUs, %d us critical section, %d ms\n",
+	       num_cpus, HOLD_US, RUN_MS);
+
+	total = smp_bench_run(mutex_worker, NULL, num_cpus, RUN_MS);
+	k_mutex_contention_stats_get(&test_mutex, &stats);
+	report("mutex", total, &stats);
+
+	total = smp_bench_run(sem_worker, NULL, num_cpus, RUN_MS);
+	k_sem_contention_stats_get(&test_sem, &stats);
+	report("sem", total, &stats);
+
+	return 0;
+}
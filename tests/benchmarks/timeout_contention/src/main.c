@@ -0,0 +1,67 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <smp_bench.h>
+
+/* Timers kept armed by each worker for the whole run */
+#define N_PENDING 64
+
+/* Duration of the measurement */
+#define RUN_MS 1000
+
+#define MAX_CPUS CONFIG_MP_MAX_NUM_CPUS
+
+static struct k_timer pending_timers[MAX_CPUS][N_PENDING];
+static struct k_timer test_timers[MAX_CPUS];
+
+static uint32_t worker(unsigned int cpu, void *arg)
+{
+	uint32_t count = 0U;
+
+	ARG_UNUSED(arg);
+
+	for (int i = 0; i < N_PENDING; i++) {
+		k_timer_init(&pending_timers[cpu][i], NULL, NULL);
+		k_timer_start(&pending_timers[cpu][i], K_SECONDS(1000 + i),
+			      K_NO_WAIT);
+	}
+	k_timer_init(&test_timers[cpu], NULL, NULL);
+
+	smp_bench_wait();
+
+	while (smp_bench_running()) {
+		k_timer_start(&test_timers[cpu], K_SECONDS(2000), K_NO_WAIT);
+		k_timer_stop(&test_timers[cpu]);
+		count++;
+	}
+
+	for (int i = 0; i < N_PENDING; i++) {
+		k_timer_stop(&pending_timers[cpu][i]);
+	}
+
+	return count;
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint32_t total;
+
+	printk("timeout contention: %u CPUs, %d pending timeouts per CPU, %d ms\n",
+	       num_cpus, N_PENDING, RUN_MS);
+
+	total = smp_bench_run(worker, NULL, num_cpus, RUN_MS);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		printk("cpu %u: %u arm/cancel ops\n", i, smp_bench_ops(i));
+	}
+
+	printk("total: %u arm/cancel ops\n", total);
+
+	return 0;
+}
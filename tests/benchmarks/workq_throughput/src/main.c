@@ -0,0 +1,86 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <smp_bench.h>
+
+/* Successful submissions across all submitters */
+#define TOTAL_ITEMS 1000000U
+
+/* Work items owned by each submitter */
+#define ITEMS_PER_THREAD 32
+
+#define MAX_CPUS CONFIG_MP_MAX_NUM_CPUS
+
+#ifdef CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE
+#define SYS_WORK_Q_THREADS (1 + CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE)
+#else
+#define SYS_WORK_Q_THREADS 1
+#endif
+
+static struct k_work items[MAX_CPUS][ITEMS_PER_THREAD];
+
+static atomic_t handled;
+
+static void handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	atomic_inc(&handled);
+}
+
+static uint32_t submitter(unsigned int cpu, void *arg)
+{
+	uint32_t quota = *(uint32_t *)arg;
+	uint32_t submitted = 0U;
+	unsigned int i = 0U;
+
+	smp_bench_wait();
+
+	/* Items still queued are skipped (0 returned), items being
+	 * run are queued again and will run once more.
+	 */
+	while (submitted < quota) {
+		if (k_work_submit(&items[cpu][i]) > 0) {
+			submitted++;
+		}
+		i = (i + 1U) % ITEMS_PER_THREAD;
+	}
+
+	return submitted;
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint32_t quota = TOTAL_ITEMS / num_cpus;
+	uint32_t total = quota * num_cpus;
+	int64_t elapsed;
+
+	printk("workq throughput: %u CPUs, %d system work queue threads, %u items\n",
+	       num_cpus, SYS_WORK_Q_THREADS, total);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		for (unsigned int j = 0; j < ITEMS_PER_THREAD; j++) {
+			k_work_init(&items[i][j], handler);
+		}
+	}
+
+	/* Submitters run until they used up their quota */
+	(void)smp_bench_run(submitter, &quota, num_cpus, 0);
+
+	while ((uint32_t)atomic_get(&handled) < total) {
+		k_msleep(1);
+	}
+
+	elapsed = k_uptime_get() - smp_bench_start_time();
+
+	printk("workq: %u items in %u ms\n", (uint32_t)atomic_get(&handled),
+	       (uint32_t)elapsed);
+
+	return 0;
+}
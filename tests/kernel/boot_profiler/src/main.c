@@ -0,0 +1,132 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/debug/boot_profiler.h>
+
+#define SLOW_INIT_US 2000
+
+/* Level numbers as used in boot profiler records */
+#define LEVEL_POST_KERNEL 3
+#define LEVEL_APPLICATION 4
+
+static int slow_sys_init(void)
+{
+	k_busy_wait(SLOW_INIT_US);
+
+	return 0;
+}
+
+SYS_INIT(slow_sys_init, APPLICATION, 0);
+
+static int failing_dev_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return -EIO;
+}
+
+DEVICE_DEFINE(failing_dev, "failing_dev", failing_dev_init, NULL, NULL, NULL,
+	      POST_KERNEL, 0, NULL);
+
+static const struct boot_profiler_record *find_record(
+	bool (*match)(const struct boot_profiler_record *rec, const void *arg),
+	const void *arg, size_t *index)
+{
+	const struct boot_profiler_record *recs;
+	size_t count = boot_profiler_records_get(&recs, NULL);
+
+	for (size_t i = 0; i < count; i++) {
+		if (match(&recs[i], arg)) {
+			if (index != NULL) {
+				*index = i;
+			}
+			return &recs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static bool match_sys(const struct boot_profiler_record *rec, const void *arg)
+{
+	return (rec->entry != NULL) && (rec->entry->dev == NULL) &&
+	       ((const void *)rec->entry->init_fn.sys == arg);
+}
+
+static bool match_dev(const struct boot_profiler_record *rec, const void *arg)
+{
+	return (rec->entry != NULL) && (rec->entry->dev == arg);
+}
+
+static bool match_level(const struct boot_profiler_record *rec, const void *arg)
+{
+	return (rec->entry == NULL) && (rec->level == POINTER_TO_UINT(arg));
+}
+
+/**
+ * @brief Test that SYS_INIT entries are timed
+ *
+ * @ingroup kernel_init_tests
+ */
+ZTEST(boot_profiler, test_sys_init_timed)
+{
+	const struct boot_profiler_record *rec;
+
+	rec = find_record(match_sys, (const void *)slow_sys_init, NULL);
+	zassert_not_null(rec, "no record for SYS_INIT entry");
+	zassert_equal(rec->level, LEVEL_APPLICATION);
+	zassert_equal(rec->result, 0);
+	zassert_true(k_cyc_to_us_ceil32(rec->end - rec->start) >= SLOW_INIT_US,
+		     "SYS_INIT entry took %u us",
+		     k_cyc_to_us_ceil32(rec->end - rec->start));
+}
+
+/**
+ * @brief Test that device init entries are recorded with their result
+ *
+ * @ingroup kernel_init_tests
+ */
+ZTEST(boot_profiler, test_device_result)
+{
+	const struct boot_profiler_record *rec;
+
+	rec = find_record(match_dev, DEVICE_GET(failing_dev), NULL);
+	zassert_not_null(rec, "no record for device");
+	zassert_equal(rec->level, LEVEL_POST_KERNEL);
+	zassert_equal(rec->result, -EIO);
+}
+
+/**
+ * @brief Test that init levels are recorded after their entries
+ *
+ * @ingroup kernel_init_tests
+ */
+ZTEST(boot_profiler, test_levels)
+{
+	const struct boot_profiler_record *recs, *level, *entry;
+	size_t level_idx, entry_idx, dropped;
+
+	boot_profiler_records_get(&recs, &dropped);
+	zassert_equal(dropped, 0, "%zu records dropped", dropped);
+
+	for (uintptr_t i = 0; i <= LEVEL_APPLICATION; i++) {
+		zassert_not_null(find_record(match_level, UINT_TO_POINTER(i), NULL),
+				 "no record for level %s",
+				 boot_profiler_level_name(i));
+	}
+
+	level = find_record(match_level, UINT_TO_POINTER(LEVEL_APPLICATION),
+			    &level_idx);
+	entry = find_record(match_sys, (const void *)slow_sys_init, &entry_idx);
+	zassert_true(entry_idx < level_idx);
+	zassert_true((uint32_t)(level->end - level->start) >=
+		     (uint32_t)(entry->end - entry->start));
+}
+
+ZTEST_SUITE(boot_profiler, NULL, NULL, NULL, NULL, NULL);
@@ -336,11 +336,11 @@ void alloc_and_free_predefined(void)
 	zassert_true(cmp_u32_arrays(ba_128.bundles, ba_128_expected, ba_128.num_bundles),
 		     "sys_bitarray_free() failed bits comparison");
 
-	/* test in-between bundles */
-	ba_128.bundles[0] = 0x7FFFFFFF;
-	ba_128.bundles[1] = 0xFFFFFFFF;
-	ba_128.bundles[2] = 0x00000000;
-	ba_128.bundles[3] = 0x00000000;
+	/* test in-between bundles, only setting the bits through the API
+	 * now that allocations may have built a summary of them
+	 */
+	zassert_equal(sys_bitarray_clear_region(&ba_128, 128, 0), 0);
+	zassert_equal(sys_bitarray_set_region(&ba_128, 63, 0), 0);
 
 	ba_128_expected[0] = 0x7FFFFFFF;
 	ba_128_expected[1] = 0xFFFFFFFF;
@@ -660,6 +660,34 @@ ZTEST(bitarray, test_bitarray_region_set_clear)
 	zassert_false(sys_bitarray_is_region_set(&bw, 40, 60));
 }
 
+/**
+ * @brief Test allocation from a bit array set up without SYS_BITARRAY_DEFINE()
+ *
+ * @details Such a bit array has no free space summary, allocation must
+ * still work with CONFIG_SYS_BITARRAY_SUMMARY enabled.
+ *
+ * @see sys_bitarray_alloc()
+ */
+ZTEST(bitarray, test_bitarray_alloc_no_define)
+{
+	int ret;
+	size_t offset;
+	static uint32_t bundles[4] = { 0xFFFFFFFF, 0x0000FFFF };
+	static sys_bitarray_t ba = {
+		.num_bits = 128,
+		.num_bundles = 4,
+		.bundles = bundles,
+	};
+
+	ret = sys_bitarray_alloc(&ba, 24, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed: %d", ret);
+	zassert_equal(offset, 48, "sys_bitarray_alloc() offset expected %d, got %d", 48, offset);
+	zassert_true(sys_bitarray_is_region_set(&ba, 24, 48));
+
+	ret = sys_bitarray_free(&ba, 24, 48);
+	zassert_equal(ret, 0, "sys_bitarray_free() failed: %d", ret);
+}
+
 /**
  * @brief Test find MSB and LSB operations
  *
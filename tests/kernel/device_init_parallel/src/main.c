@@ -0,0 +1,97 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/device.h>
+
+#define TEST_GPIO DT_NODELABEL(test_gpio_0)
+#define TEST_I2C DT_NODELABEL(test_i2c)
+#define TEST_DEVA DT_NODELABEL(test_dev_a)
+
+#define INIT_SLEEP_MS 50
+/* The four slow devices come first and there are enough init threads for
+ * all of them to start at once. test_dev_a comes last and has to wait for
+ * the two it depends on.
+ */
+#define INIT_PRIO 50
+#define INIT_PRIO_DEPENDENT 51
+
+struct init_record {
+	uint32_t start;
+	uint32_t end;
+};
+
+static struct init_record gpio_rec, i2c_rec, slow_a_rec, slow_b_rec;
+static bool dev_a_deps_ready;
+
+static int slow_init(const struct device *dev)
+{
+	struct init_record *rec = (struct init_record *)dev->data;
+
+	rec->start = k_uptime_get_32();
+	k_msleep(INIT_SLEEP_MS);
+	rec->end = k_uptime_get_32();
+
+	return 0;
+}
+
+static int dev_a_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	dev_a_deps_ready = device_is_ready(DEVICE_DT_GET(TEST_GPIO)) &&
+			   device_is_ready(DEVICE_DT_GET(TEST_I2C));
+
+	return 0;
+}
+
+DEVICE_DT_DEFINE(TEST_GPIO, slow_init, NULL, &gpio_rec, NULL,
+		 POST_KERNEL, INIT_PRIO, NULL);
+DEVICE_DT_DEFINE(TEST_I2C, slow_init, NULL, &i2c_rec, NULL,
+		 POST_KERNEL, INIT_PRIO, NULL);
+DEVICE_DT_DEFINE(TEST_DEVA, dev_a_init, NULL, NULL, NULL,
+		 POST_KERNEL, INIT_PRIO_DEPENDENT, NULL);
+DEVICE_DEFINE(slow_a, "slow_a", slow_init, NULL, &slow_a_rec, NULL,
+	      POST_KERNEL, INIT_PRIO, NULL);
+DEVICE_DEFINE(slow_b, "slow_b", slow_init, NULL, &slow_b_rec, NULL,
+	      POST_KERNEL, INIT_PRIO, NULL);
+
+static bool overlap(const struct init_record *a, const struct init_record *b)
+{
+	return (a->start < b->end) && (b->start < a->end);
+}
+
+/**
+ * @brief Test that a device starts only after its devicetree dependencies
+ *
+ * @ingroup kernel_device_tests
+ */
+ZTEST(device_init_parallel, test_dependencies_honored)
+{
+	zassert_true(device_is_ready(DEVICE_DT_GET(TEST_DEVA)));
+	zassert_true(dev_a_deps_ready,
+		     "device initialized before its dependencies");
+}
+
+/**
+ * @brief Test that devices without dependencies initialize concurrently
+ *
+ * @ingroup kernel_device_tests
+ */
+ZTEST(device_init_parallel, test_independent_overlap)
+{
+	zassert_true(device_is_ready(DEVICE_GET(slow_a)));
+	zassert_true(device_is_ready(DEVICE_GET(slow_b)));
+	zassert_true(overlap(&slow_a_rec, &slow_b_rec),
+		     "slow_a [%u, %u] and slow_b [%u, %u] ran serially",
+		     slow_a_rec.start, slow_a_rec.end,
+		     slow_b_rec.start, slow_b_rec.end);
+	zassert_true(overlap(&gpio_rec, &i2c_rec),
+		     "gpio and i2c ran serially");
+}
+
+ZTEST_SUITE(device_init_parallel, NULL, NULL, NULL, NULL, NULL);
@@ -112,6 +112,9 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+	printk("* Read-ahead (%s):\n", scope);
+	printk("    - Pages read ahead: %lu\n", stats->read_ahead.cnt);
 }
 
 ZTEST(demand_paging, test_touch_anon_pages)
@@ -154,6 +157,10 @@ ZTEST(demand_paging, test_touch_anon_pages)
 	print_paging_stats(&stats, "kernel");
 	zassert_not_equal(stats.eviction.dirty, 0UL,
 			  "there should be dirty pages being evicted.");
+#if CONFIG_BACKING_STORE_READ_AHEAD_PAGES > 0
+	zassert_not_equal(stats.read_ahead.cnt, 0UL,
+			  "there should be pages read ahead.");
+#endif
 
 #ifdef CONFIG_EVICTION_NRU
 	k_msleep(CONFIG_EVICTION_NRU_PERIOD * 2);
@@ -191,16 +198,83 @@ ZTEST(demand_paging, test_touch_anon_pages)
 	}
 }
 
+ZTEST(demand_paging, test_writeback)
+{
+#ifdef CONFIG_DEMAND_PAGING_WRITEBACK
+	struct k_mem_paging_stats_t stats, thread_stats;
+	unsigned long evicted, dirty;
+	size_t free_pages;
+
+	k_mem_paging_stats_get(&stats);
+	k_mem_paging_thread_stats_get(k_current_get(), &thread_stats);
+	evicted = (stats.eviction.clean + stats.eviction.dirty) -
+		  (thread_stats.eviction.clean + thread_stats.eviction.dirty);
+	dirty = stats.eviction.dirty - thread_stats.eviction.dirty;
+
+	/* Dirty the whole arena, which does not fit in RAM. The test thread
+	 * is cooperative, so the write-back thread cannot run meanwhile.
+	 */
+	for (size_t i = 0; i < arena_size; i++) {
+		arena[i] = nums[i % 10];
+	}
+
+	free_pages = z_free_page_count;
+	zassert_true(free_pages < CONFIG_DEMAND_PAGING_WRITEBACK_LOW_WATERMARK,
+		     "%zu free page frames, write-back not triggered", free_pages);
+
+	for (int i = 0; i < 100; i++) {
+		if (z_free_page_count >= CONFIG_DEMAND_PAGING_WRITEBACK_HIGH_WATERMARK) {
+			break;
+		}
+		k_msleep(1);
+	}
+	zassert_true(z_free_page_count >= CONFIG_DEMAND_PAGING_WRITEBACK_HIGH_WATERMARK,
+		     "only %zu free page frames after write-back", z_free_page_count);
+
+	/* Evictions not done by the test thread were done by write-back */
+	k_mem_paging_stats_get(&stats);
+	k_mem_paging_thread_stats_get(k_current_get(), &thread_stats);
+	evicted = (stats.eviction.clean + stats.eviction.dirty) -
+		  (thread_stats.eviction.clean + thread_stats.eviction.dirty) - evicted;
+	dirty = stats.eviction.dirty - thread_stats.eviction.dirty - dirty;
+	zassert_true(evicted >= CONFIG_DEMAND_PAGING_WRITEBACK_HIGH_WATERMARK - free_pages,
+		     "write-back evicted %lu pages", evicted);
+	zassert_not_equal(dirty, 0UL, "write-back cleaned no dirty pages");
+
+	/* The written back pages must page in intact */
+	for (size_t i = 0; i < arena_size; i++) {
+		zassert_equal(arena[i], nums[i % 10],
+			      "arena corrupted at index %d (%p): got 0x%hhx expected 0x%hhx",
+			      i, &arena[i], arena[i], nums[i % 10]);
+	}
+
+	/* Reset arena to zero */
+	for (size_t i = 0; i < arena_size; i++) {
+		arena[i] = 0;
+	}
+#else
+	ztest_test_skip();
+#endif /* CONFIG_DEMAND_PAGING_WRITEBACK */
+}
+
 static void test_k_mem_page_out(void)
 {
 	unsigned long faults;
 	int key, ret;
+#if CONFIG_BACKING_STORE_READ_AHEAD_PAGES > 0
+	struct k_mem_paging_stats_t stats;
+	unsigned long read_ahead;
+#endif
 
 	/* Lock IRQs to prevent other pagefaults from happening while we
 	 * are measuring stuff
 	 */
 	key = irq_lock();
 	faults = z_num_pagefaults_get();
+#if CONFIG_BACKING_STORE_READ_AHEAD_PAGES > 0
+	k_mem_paging_stats_get(&stats);
+	read_ahead = stats.read_ahead.cnt;
+#endif
 	ret = k_mem_page_out(arena, HALF_BYTES);
 	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
 
@@ -209,11 +283,28 @@ static void test_k_mem_page_out(void)
 		arena[i] = nums[i % 10];
 	}
 	faults = z_num_pagefaults_get() - faults;
+#if CONFIG_BACKING_STORE_READ_AHEAD_PAGES > 0
+	k_mem_paging_stats_get(&stats);
+	read_ahead = stats.read_ahead.cnt - read_ahead;
+#endif
 	irq_unlock(key);
 
+#if CONFIG_BACKING_STORE_READ_AHEAD_PAGES > 0
+	/* Every evicted page comes back either by faulting on it or by
+	 * being read ahead of such a fault; read-ahead may also continue
+	 * past the region into pages that were evicted earlier.
+	 */
+	zassert_not_equal(read_ahead, 0, "no pages were read ahead");
+	zassert_true(faults < HALF_PAGES,
+		     "read-ahead did not save any pagefault, got %lu", faults);
+	zassert_true(faults + read_ahead >= HALF_PAGES,
+		     "%lu pagefaults and %lu pages read ahead for %lu pages",
+		     faults, read_ahead, HALF_PAGES);
+#else
 	zassert_equal(faults, HALF_PAGES,
 		      "unexpected num pagefaults expected %lu got %d",
 		      HALF_PAGES, faults);
+#endif
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -402,6 +493,12 @@ ZTEST_USER(demand_paging_stat, test_user_get_hist)
 	zassert_true(print_histogram(&hist),
 		     "should have non-zero counts in histogram.");
 	printk("\n");
+
+	printk("Page Fault Histogram:\n");
+	k_mem_paging_histogram_pagefault_get(&hist);
+	zassert_true(print_histogram(&hist),
+		     "should have non-zero counts in histogram.");
+	printk("\n");
 }
 
 void *demand_paging_api_setup(void)
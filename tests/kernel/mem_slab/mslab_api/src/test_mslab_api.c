@@ -338,3 +338,71 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, &b);
 }
+
+#if defined(CONFIG_MEM_SLAB_CPU_CACHE) && defined(CONFIG_SCHED_CPU_MASK)
+static K_THREAD_STACK_DEFINE(cache_stack, STACKSIZE);
+static struct k_thread cache_thread;
+
+static void cache_alloc_thread(void *p0, void *p1, void *p2)
+{
+	void **block = p0;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+
+	for (int i = 0; i < BLK_NUM; i++) {
+		zassert_equal(k_mem_slab_alloc(&mslab, &block[i], K_NO_WAIT), 0,
+			      "Failed k_mem_slab_alloc");
+	}
+}
+
+static void cache_free_thread(void *p0, void *p1, void *p2)
+{
+	void **block = p0;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+
+	for (int i = 0; i < BLK_NUM; i++) {
+		k_mem_slab_free(&mslab, &block[i]);
+	}
+}
+
+static void run_on_cpu(k_thread_entry_t entry, void **block, int cpu)
+{
+	k_thread_create(&cache_thread, cache_stack, STACKSIZE, entry, block,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_FOREVER);
+	zassert_ok(k_thread_cpu_pin(&cache_thread, cpu));
+	k_thread_start(&cache_thread);
+	zassert_ok(k_thread_join(&cache_thread, K_FOREVER));
+}
+
+/**
+ * @brief Verify that blocks cached by one CPU are available to another
+ *
+ * @details All blocks are allocated and freed on CPU 1, which leaves
+ * them in its magazine.  Allocating them all on CPU 0 then has to
+ * flush that magazine back to the slab instead of failing.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_cpu_cache)
+{
+	void *block[BLK_NUM];
+
+	if (arch_num_cpus() < 2) {
+		ztest_test_skip();
+	}
+
+	run_on_cpu(cache_alloc_thread, block, 1);
+	run_on_cpu(cache_free_thread, block, 1);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), BLK_NUM);
+
+	run_on_cpu(cache_alloc_thread, block, 0);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), BLK_NUM);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), 0);
+
+	run_on_cpu(cache_free_thread, block, 0);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+}
+#endif
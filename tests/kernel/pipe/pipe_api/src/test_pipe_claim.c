@@ -0,0 +1,172 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for in-place pipe buffer access
+ * @ingroup kernel_pipe_tests
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_PIPES_CLAIM
+
+#define CLAIM_PIPE_SIZE 8
+#define CLAIM_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_PIPE_DEFINE(claim_pipe, CLAIM_PIPE_SIZE, 4);
+K_PIPE_DEFINE(watermark_pipe, CLAIM_PIPE_SIZE, 4);
+K_PIPE_DEFINE(avail_pipe, CLAIM_PIPE_SIZE, 4);
+static K_THREAD_STACK_DEFINE(claim_stack, CLAIM_STACK_SIZE);
+static struct k_thread claim_thread;
+static unsigned char claim_rx[4];
+static size_t claim_rx_len;
+
+static void put_in_place(struct k_pipe *p, const char *src, size_t len,
+			 size_t expected)
+{
+	uint8_t *data;
+	size_t n = k_pipe_put_claim(p, &data, len);
+
+	zassert_equal(n, expected, "claimed %zu, expected %zu", n, expected);
+	memcpy(data, src, n);
+	zassert_equal(k_pipe_put_commit(p, n), 0);
+}
+
+static void get_in_place(struct k_pipe *p, const char *expected, size_t len)
+{
+	uint8_t *data;
+	size_t n = k_pipe_get_claim(p, &data, len);
+
+	zassert_equal(n, len, "claimed %zu, expected %zu", n, len);
+	zassert_mem_equal(data, expected, len);
+}
+
+static void claim_reader(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	(void)k_pipe_get(&watermark_pipe, claim_rx, sizeof(claim_rx),
+			 &claim_rx_len, sizeof(claim_rx), K_FOREVER);
+}
+
+/**
+ * @brief Test claims across the end of the pipe buffer
+ *
+ * Claims never span the end of the buffer, so writing or reading around
+ * it takes two claims.
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_wrap)
+{
+	uint8_t *data;
+
+	put_in_place(&claim_pipe, "abcdef", 6, 6);
+
+	get_in_place(&claim_pipe, "abcd", 4);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 4), 0);
+
+	/* Only the two bytes up to the end of the buffer are contiguous */
+	put_in_place(&claim_pipe, "ghijkl", 6, 2);
+	put_in_place(&claim_pipe, "ijkl", 4, 4);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), 0);
+
+	/* Claims add up until released */
+	get_in_place(&claim_pipe, "efgh", 4);
+	get_in_place(&claim_pipe, "ijkl", 4);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 8), 0);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+
+	/* Claimed space is not available to other writers */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 3), 3);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_SIZE - 3);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 0), 0);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_SIZE);
+
+	/* Nothing is claimed anymore */
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 1), -EINVAL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 1), -EINVAL);
+}
+
+/**
+ * @brief Test the available counts while claims are pending
+ *
+ * Claimed data is no longer readable, and claimed space no longer
+ * writable, yet neither is free until the claim is released.
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_avail)
+{
+	uint8_t *data;
+
+	put_in_place(&avail_pipe, "abcd", 4, 4);
+	zassert_equal(k_pipe_read_avail(&avail_pipe), 4);
+	zassert_equal(k_pipe_write_avail(&avail_pipe), CLAIM_PIPE_SIZE - 4);
+
+	get_in_place(&avail_pipe, "abc", 3);
+	zassert_equal(k_pipe_read_avail(&avail_pipe), 1);
+	zassert_equal(k_pipe_write_avail(&avail_pipe), CLAIM_PIPE_SIZE - 4);
+
+	zassert_equal(k_pipe_put_claim(&avail_pipe, &data, 2), 2);
+	zassert_equal(k_pipe_read_avail(&avail_pipe), 1);
+	zassert_equal(k_pipe_write_avail(&avail_pipe), CLAIM_PIPE_SIZE - 6);
+
+	/* Releasing the claims frees the space read in place */
+	zassert_equal(k_pipe_put_commit(&avail_pipe, 0), 0);
+	zassert_equal(k_pipe_get_finish(&avail_pipe, 3), 0);
+	zassert_equal(k_pipe_read_avail(&avail_pipe), 1);
+	zassert_equal(k_pipe_write_avail(&avail_pipe), CLAIM_PIPE_SIZE - 1);
+
+	get_in_place(&avail_pipe, "d", 1);
+	zassert_equal(k_pipe_get_finish(&avail_pipe, 1), 0);
+	zassert_equal(k_pipe_read_avail(&avail_pipe), 0);
+}
+
+/**
+ * @brief Test that readers are only woken at the watermark
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_watermark)
+{
+#ifdef CONFIG_POLL
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_PIPE_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+		&watermark_pipe);
+#endif
+
+	/* A watermark above the buffer size could never be reached */
+	zassert_equal(k_pipe_watermark_set(&watermark_pipe, CLAIM_PIPE_SIZE + 1),
+		      -EINVAL);
+	zassert_ok(k_pipe_watermark_set(&watermark_pipe, sizeof(claim_rx)));
+	claim_rx_len = 0;
+
+	k_thread_create(&claim_thread, claim_stack, CLAIM_STACK_SIZE,
+			claim_reader, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+
+	/* Below the watermark, the data stays in the pipe buffer */
+	put_in_place(&watermark_pipe, "ab", 2, 2);
+	k_sleep(K_MSEC(10));
+	zassert_equal(claim_rx_len, 0);
+	zassert_equal(k_pipe_read_avail(&watermark_pipe), 2);
+#ifdef CONFIG_POLL
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+#endif
+
+	put_in_place(&watermark_pipe, "cd", 2, 2);
+	zassert_equal(k_thread_join(&claim_thread, K_MSEC(100)), 0);
+	zassert_equal(claim_rx_len, sizeof(claim_rx));
+	zassert_mem_equal(claim_rx, "abcd", sizeof(claim_rx));
+	zassert_equal(k_pipe_read_avail(&watermark_pipe), 0);
+
+	zassert_ok(k_pipe_watermark_set(&watermark_pipe, 0));
+}
+
+#endif /* CONFIG_PIPES_CLAIM */
+
+/**
+ * @}
+ */
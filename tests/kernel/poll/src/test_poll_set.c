@@ -0,0 +1,183 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#ifdef CONFIG_POLL_SET
+
+static struct k_poll_set set;
+static struct k_sem set_sem;
+static struct k_fifo set_fifo;
+static struct k_poll_signal set_signal;
+static struct k_poll_event set_events[3];
+
+static void set_timer_cb(struct k_timer *timer)
+{
+	k_poll_signal_raise(&set_signal, 0x1337);
+}
+
+static K_TIMER_DEFINE(set_timer, set_timer_cb, NULL);
+
+static void set_setup(void)
+{
+	k_sem_init(&set_sem, 0, 1);
+	k_fifo_init(&set_fifo);
+	k_poll_signal_init(&set_signal);
+
+	k_poll_event_init(&set_events[0], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_sem);
+	k_poll_event_init(&set_events[1], K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_fifo);
+	k_poll_event_init(&set_events[2], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+
+	k_poll_set_init(&set);
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		k_poll_set_add(&set, &set_events[i]);
+	}
+}
+
+static void set_teardown(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		zassert_equal(k_poll_set_remove(&set, &set_events[i]), 0);
+	}
+}
+
+/**
+ * @brief Test that poll set registrations persist across waits
+ *
+ * @details Add events to a poll set, make them ready and consume them
+ * several times, and check that each wait returns exactly the ready
+ * events, without the events being added again.
+ *
+ * @see k_poll_set_add(), k_poll_set_wait(), k_poll_set_remove()
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set_persistent)
+{
+	struct k_poll_event *ready[ARRAY_SIZE(set_events)];
+	int rc;
+
+	set_setup();
+
+	/* Nothing is ready */
+	rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(rc, -EAGAIN);
+
+	for (int round = 0; round < 3; round++) {
+		k_sem_give(&set_sem);
+
+		rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT);
+		zassert_equal(rc, 1);
+		zassert_equal_ptr(ready[0], &set_events[0]);
+		zassert_equal(set_events[0].state, K_POLL_STATE_SEM_AVAILABLE);
+
+		/* Level triggered: still ready until taken */
+		rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT);
+		zassert_equal(rc, 1);
+		zassert_equal_ptr(ready[0], &set_events[0]);
+
+		zassert_equal(k_sem_take(&set_sem, K_NO_WAIT), 0);
+		rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT);
+		zassert_equal(rc, -EAGAIN);
+		zassert_equal(set_events[0].state, K_POLL_STATE_NOT_READY);
+	}
+
+	/* Several ready events are returned up to the room given */
+	k_sem_give(&set_sem);
+	k_poll_signal_raise(&set_signal, 0);
+
+	rc = k_poll_set_wait(&set, ready, 1, K_NO_WAIT);
+	zassert_equal(rc, 1);
+	rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(rc, 2);
+	zassert_not_equal(ready[0], ready[1]);
+	zassert_not_equal(ready[0], &set_events[1]);
+	zassert_not_equal(ready[1], &set_events[1]);
+
+	zassert_equal(k_sem_take(&set_sem, K_NO_WAIT), 0);
+	k_poll_signal_reset(&set_signal);
+	rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(rc, -EAGAIN);
+
+	set_teardown();
+	zassert_equal(k_poll_set_remove(&set, &set_events[0]), -EINVAL);
+}
+
+/**
+ * @brief Test waiting on a poll set
+ *
+ * @details Block on a poll set until a timer raises a signal added to
+ * it, and check that a wait with nothing ready times out.
+ *
+ * @see k_poll_set_wait()
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[ARRAY_SIZE(set_events)];
+	unsigned int signaled;
+	int result;
+	int rc;
+
+	set_setup();
+
+	rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(10));
+	zassert_equal(rc, -EAGAIN);
+
+	k_timer_start(&set_timer, K_MSEC(10), K_NO_WAIT);
+
+	rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(1000));
+	zassert_equal(rc, 1);
+	zassert_equal_ptr(ready[0], &set_events[2]);
+	zassert_equal(set_events[2].state, K_POLL_STATE_SIGNALED);
+
+	k_poll_signal_check(&set_signal, &signaled, &result);
+	zassert_not_equal(signaled, 0);
+	zassert_equal(result, 0x1337);
+	k_poll_signal_reset(&set_signal);
+
+	set_teardown();
+}
+
+/**
+ * @brief Test adding and removing an ignored event
+ *
+ * @details An ignored event is never linked to an object, and its node
+ * is left uninitialized.  Check that it never becomes ready and that it
+ * can be removed from the set.
+ *
+ * @see k_poll_set_add(), k_poll_set_remove()
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ignore)
+{
+	struct k_poll_event *ready[1];
+	struct k_poll_event event;
+	int rc;
+
+	(void)memset(&event, 0xa5, sizeof(event));
+	k_poll_event_init(&event, K_POLL_TYPE_IGNORE, K_POLL_MODE_NOTIFY_ONLY,
+			  &set_sem);
+
+	k_poll_set_init(&set);
+	k_poll_set_add(&set, &event);
+
+	rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(rc, -EAGAIN);
+
+	zassert_equal(k_poll_set_remove(&set, &event), 0);
+}
+
+#endif /* CONFIG_POLL_SET */
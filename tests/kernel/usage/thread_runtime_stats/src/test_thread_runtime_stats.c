@@ -539,5 +539,64 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+static uint32_t hist_sum(const uint32_t *buckets)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS; i++) {
+		sum += buckets[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Test the wakeup latency and run slice histograms
+ *
+ * Sleep a number of times. Each sleep ends one run slice of the current
+ * thread, and each wakeup adds one latency sample.
+ */
+ZTEST(usage_api, test_thread_stats_histogram)
+{
+	struct k_cycle_histogram hist1;
+	struct k_cycle_histogram hist2;
+	k_thread_runtime_stats_t stats;
+	int status;
+
+	status = k_thread_runtime_histogram_get(NULL, &hist1);
+	zassert_true(status == -EINVAL);
+
+	status = k_thread_runtime_histogram_get(_current, NULL);
+	zassert_true(status == -EINVAL);
+
+	status = k_cpu_runtime_histogram_get(arch_num_cpus(), &hist1);
+	zassert_true(status == -EINVAL);
+
+	status = k_thread_runtime_histogram_get(_current, &hist1);
+	zassert_true(status == 0);
+
+	for (int i = 0; i < 5; i++) {
+		k_sleep(K_TICKS(1));
+	}
+
+	status = k_thread_runtime_histogram_get(_current, &hist2);
+	zassert_true(status == 0);
+
+	zassert_true(hist_sum(hist2.latency) >= hist_sum(hist1.latency) + 5);
+	zassert_true(hist_sum(hist2.slice) >= hist_sum(hist1.slice) + 5);
+
+	/* The histograms are also part of the runtime stats */
+
+	k_thread_runtime_stats_get(_current, &stats);
+	zassert_true(hist_sum(stats.histogram.latency) >=
+		     hist_sum(hist2.latency));
+
+	status = k_cpu_runtime_histogram_get(0, &hist1);
+	zassert_true(status == 0);
+	zassert_true(hist_sum(hist1.slice) > 0);
+}
+#endif
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -126,6 +126,39 @@ static inline int system_counter(void)
 	return atomic_get(&system_ctr);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* A preemptible work queue served by a pool of threads. */
+#define POOL_SIZE 2
+
+static K_THREAD_STACK_DEFINE(pool_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, POOL_SIZE, STACK_SIZE);
+static k_thread_stack_t *const pool_stack_ptrs[POOL_SIZE] = {
+	pool_stacks[0],
+	pool_stacks[1],
+};
+static struct k_thread pool_threads[POOL_SIZE];
+static struct k_work_q pool_queue;
+static atomic_t pool_ctr;
+static inline int pool_counter(void)
+{
+	return atomic_get(&pool_ctr);
+}
+#endif
+
+/* Whether the current thread is one of those serving @p wq. */
+static bool queue_thread_is_current(struct k_work_q *wq)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	for (size_t i = 0; i < wq->pool_size; i++) {
+		if (k_current_get() == &wq->pool_threads[i]) {
+			return true;
+		}
+	}
+#endif
+
+	return k_current_get() == &wq->thread;
+}
+
 static inline void reset_counters(void)
 {
 	/* If this fails the previous test didn't clean up */
@@ -136,6 +169,9 @@ static inline void reset_counters(void)
 	atomic_set(&system_ctr, 0);
 	atomic_set(&cooplo_ctr, 0);
 	atomic_set(&preempt_ctr, 0);
+#ifdef CONFIG_WORKQUEUE_POOL
+	atomic_set(&pool_ctr, 0);
+#endif
 }
 
 static void counter_handler(struct k_work *work)
@@ -143,12 +179,16 @@ static void counter_handler(struct k_work *work)
 	last_handle_ms = k_uptime_get_32();
 	if (k_current_get() == &coophi_queue.thread) {
 		atomic_inc(&coophi_ctr);
-	} else if (k_current_get() == &k_sys_work_q.thread) {
+	} else if (queue_thread_is_current(&k_sys_work_q)) {
 		atomic_inc(&system_ctr);
 	} else if (k_current_get() == &cooplo_queue.thread) {
 		atomic_inc(&cooplo_ctr);
 	} else if (k_current_get() == &preempt_queue.thread) {
 		atomic_inc(&preempt_ctr);
+#ifdef CONFIG_WORKQUEUE_POOL
+	} else if (queue_thread_is_current(&pool_queue)) {
+		atomic_inc(&pool_ctr);
+#endif
 	}
 	if (atomic_dec(&resubmits_left) > 0) {
 		(void)k_work_submit_to_queue(NULL, work);
@@ -267,6 +307,17 @@ static void test_queue_start(void)
 			    COOPLO_PRIORITY, &cfg);
 	zassert_equal(cooplo_queue.flags,
 		      K_WORK_QUEUE_STARTED | K_WORK_QUEUE_NO_YIELD, NULL);
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	cfg.name = "wq.pool";
+	cfg.no_yield = false;
+	cfg.pool_size = POOL_SIZE;
+	cfg.pool_threads = pool_threads;
+	cfg.pool_stacks = pool_stack_ptrs;
+	k_work_queue_start(&pool_queue, pool_stack, STACK_SIZE,
+			    PREEMPT_PRIORITY, &cfg);
+	zassert_equal(pool_queue.flags, K_WORK_QUEUE_STARTED);
+#endif
 }
 
 /* Check validation of submission without a destination queue. */
@@ -313,6 +364,56 @@ ZTEST(work_1cpu, test_1cpu_simple_queue)
 	zassert_equal(rc, 0);
 }
 
+/* Single-CPU check of batched submission and coalescing. */
+ZTEST(work_1cpu, test_1cpu_batch_queue)
+{
+	struct k_work *const batch[] = { &work, &work1, &work };
+	int rc;
+
+	/* Reset state and use the non-blocking handler */
+	reset_counters();
+	k_work_init(&work, counter_handler);
+	k_work_init(&work1, counter_handler);
+
+	/* An empty batch queues nothing, a null queue is rejected */
+	rc = k_work_submit_batch(&coophi_queue, NULL, 0, 0);
+	zassert_equal(rc, 0);
+	rc = k_work_submit_batch(NULL, batch, ARRAY_SIZE(batch), 0);
+	zassert_equal(rc, -EINVAL);
+
+	/* The second submission of work is coalesced */
+	rc = k_work_submit_batch(&coophi_queue, batch, ARRAY_SIZE(batch),
+				 K_WORK_BATCH_COALESCE);
+	zassert_equal(rc, 2);
+	zassert_equal(k_work_busy_get(&work), K_WORK_QUEUED);
+	zassert_equal(k_work_busy_get(&work1), K_WORK_QUEUED);
+	zassert_equal(k_work_coalesced_take(&work), 1);
+	zassert_equal(k_work_coalesced_take(&work), 0);
+	zassert_equal(k_work_coalesced_take(&work1), 0);
+
+	/* Without the flag resubmissions are not counted */
+	rc = k_work_submit_batch(&coophi_queue, batch, ARRAY_SIZE(batch), 0);
+	zassert_equal(rc, 0);
+	zassert_equal(k_work_coalesced_take(&work), 0);
+
+	/* Shouldn't have been started since test thread is
+	 * cooperative.
+	 */
+	zassert_equal(coophi_counter(), 0);
+
+	/* Let them run, then check they finished. */
+	k_sleep(K_TICKS(1));
+	zassert_equal(coophi_counter(), 2);
+	zassert_equal(k_work_busy_get(&work), 0);
+	zassert_equal(k_work_busy_get(&work1), 0);
+
+	/* Flush the sync state from completion */
+	rc = k_sem_take(&sync_sem, K_NO_WAIT);
+	zassert_equal(rc, 0);
+	rc = k_sem_take(&sync_sem, K_NO_WAIT);
+	zassert_equal(rc, 0);
+}
+
 /* Basic SMP check submitting with a non-blocking handler. */
 ZTEST(work, test_smp_simple_queue)
 {
@@ -1441,6 +1542,73 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* Resubmit an item while it runs on a pool queue, then flush it. */
+ZTEST(work, test_pool_resubmit_running_flush)
+{
+	int rc;
+
+	/* Reset state and use the delaying handler */
+	reset_counters();
+	k_work_init(&work, delay_handler);
+
+	/* Submit to the pool queue and let it start. */
+	rc = k_work_submit_to_queue(&pool_queue, &work);
+	zassert_equal(rc, 1);
+	k_sleep(K_TICKS(1));
+	zassert_equal(k_work_busy_get(&work), K_WORK_RUNNING);
+
+	/* Resubmit it.  The idle pool threads must not take it while
+	 * it is still running.
+	 */
+	rc = k_work_submit_to_queue(&pool_queue, &work);
+	zassert_equal(rc, 1);
+	k_sleep(K_TICKS(1));
+	zassert_equal(k_work_busy_get(&work), K_WORK_RUNNING | K_WORK_QUEUED);
+	zassert_equal(pool_counter(), 0);
+
+	/* The flush waits for both the current and the queued run. */
+	zassert_true(k_work_flush(&work, &work_sync));
+	zassert_equal(pool_counter(), 2);
+	zassert_equal(k_work_busy_get(&work), 0);
+
+	/* Flush the sync state from completion */
+	rc = k_sem_take(&sync_sem, K_NO_WAIT);
+	zassert_equal(rc, 0);
+}
+
+/* Drain a pool queue while it runs several items at once. */
+ZTEST(work, test_pool_drain)
+{
+	int rc;
+
+	/* Reset state and use the delaying handler */
+	reset_counters();
+	k_work_init(&work, delay_handler);
+	k_work_init(&work1, delay_handler);
+
+	/* Submit both and let them start on separate threads. */
+	rc = k_work_submit_to_queue(&pool_queue, &work);
+	zassert_equal(rc, 1);
+	rc = k_work_submit_to_queue(&pool_queue, &work1);
+	zassert_equal(rc, 1);
+	k_sleep(K_TICKS(1));
+	zassert_equal(k_work_busy_get(&work), K_WORK_RUNNING);
+	zassert_equal(k_work_busy_get(&work1), K_WORK_RUNNING);
+
+	/* Nothing is pending, but draining waits for both to finish. */
+	rc = k_work_queue_drain(&pool_queue, false);
+	zassert_equal(rc, 1);
+	zassert_equal(pool_counter(), 2);
+	zassert_equal(k_work_busy_get(&work), 0);
+	zassert_equal(k_work_busy_get(&work1), 0);
+
+	/* Flush the sync state from completion */
+	rc = k_sem_take(&sync_sem, K_NO_WAIT);
+	zassert_equal(rc, 0);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
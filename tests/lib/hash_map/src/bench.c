@@ -0,0 +1,161 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Throughput of the default Hashmap at several load factors. Lookups of
+ * absent keys walk a whole probe sequence, so their cost against that of
+ * lookups of present keys tracks the probe length of the implementation.
+ * Compare runs of the different scenarios, and raise
+ * CONFIG_TEST_LIB_HASH_MAP_MAX_ENTRIES for more stable numbers.
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+#include "_main.h"
+
+#define BENCH_LOOKUP_ROUNDS 16
+#define BENCH_CHURN_ROUNDS  (8 * MANY)
+
+SYS_HASHMAP_DEFAULT_DEFINE_ADVANCED(bench_map_25, sys_hash32, realloc,
+				    SYS_HASHMAP_CONFIG(SIZE_MAX, 25));
+SYS_HASHMAP_DEFAULT_DEFINE_ADVANCED(bench_map_50, sys_hash32, realloc,
+				    SYS_HASHMAP_CONFIG(SIZE_MAX, 50));
+SYS_HASHMAP_DEFAULT_DEFINE_ADVANCED(bench_map_75, sys_hash32, realloc,
+				    SYS_HASHMAP_CONFIG(SIZE_MAX, 75));
+SYS_HASHMAP_DEFAULT_DEFINE_ADVANCED(bench_map_90, sys_hash32, realloc,
+				    SYS_HASHMAP_CONFIG(SIZE_MAX, 90));
+
+static struct sys_hashmap *const bench_maps[] = {
+	&bench_map_25,
+	&bench_map_50,
+	&bench_map_75,
+	&bench_map_90,
+};
+
+/* Spread keys over 64 bits, as pointers and identifiers would be */
+static uint64_t bench_key(size_t i)
+{
+	return (uint64_t)i * 0x9e3779b97f4a7c15ULL;
+}
+
+static void report(const char *what, uint32_t load_factor, uint32_t cycles, size_t ops)
+{
+	uint64_t ns = k_cyc_to_ns_ceil64(cycles);
+
+	TC_PRINT("%-12s lf %3u%% %8u cycles for %4u ops, %llu ns/op\n", what, load_factor,
+		 cycles, (unsigned int)ops, ns / ops);
+}
+
+static void bench_after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_maps); ++i) {
+		(void)sys_hashmap_clear(bench_maps[i], NULL, NULL);
+	}
+}
+
+ZTEST(hash_map_bench, test_throughput)
+{
+	int ret;
+	uint32_t start;
+	uint32_t cycles;
+	uint64_t value;
+	struct sys_hashmap *hmap;
+
+	for (size_t m = 0; m < ARRAY_SIZE(bench_maps); ++m) {
+		hmap = bench_maps[m];
+
+		start = k_cycle_get_32();
+		for (size_t i = 0; i < MANY; ++i) {
+			ret = sys_hashmap_insert(hmap, bench_key(i), i, NULL);
+			zassert_equal(1, ret, "failed to insert %zu: %d", i, ret);
+		}
+		cycles = k_cycle_get_32() - start;
+		report("insert", hmap->config->load_factor, cycles, MANY);
+
+		start = k_cycle_get_32();
+		for (size_t r = 0; r < BENCH_LOOKUP_ROUNDS; ++r) {
+			for (size_t i = 0; i < MANY; ++i) {
+				zassert_true(sys_hashmap_get(hmap, bench_key(i), &value));
+				zassert_equal(i, value);
+			}
+		}
+		cycles = k_cycle_get_32() - start;
+		report("get (hit)", hmap->config->load_factor, cycles,
+		       BENCH_LOOKUP_ROUNDS * MANY);
+
+		start = k_cycle_get_32();
+		for (size_t r = 0; r < BENCH_LOOKUP_ROUNDS; ++r) {
+			for (size_t i = MANY; i < 2 * MANY; ++i) {
+				zassert_false(sys_hashmap_get(hmap, bench_key(i), NULL));
+			}
+		}
+		cycles = k_cycle_get_32() - start;
+		report("get (miss)", hmap->config->load_factor, cycles,
+		       BENCH_LOOKUP_ROUNDS * MANY);
+
+		start = k_cycle_get_32();
+		for (size_t i = 0; i < MANY; ++i) {
+			zassert_true(sys_hashmap_remove(hmap, bench_key(i), NULL));
+		}
+		cycles = k_cycle_get_32() - start;
+		report("remove", hmap->config->load_factor, cycles, MANY);
+
+		zassert_true(sys_hashmap_is_empty(hmap));
+	}
+}
+
+/*
+ * Keep a sliding window of keys in the Hashmap, removing the oldest key for
+ * each one inserted. This is where tombstones pile up, so also check that
+ * lookups keep working and that the table does not keep growing.
+ */
+ZTEST(hash_map_bench, test_churn)
+{
+	int ret;
+	uint32_t start;
+	uint32_t cycles;
+	size_t n_buckets;
+	const size_t window = MANY / 2;
+	struct sys_hashmap *hmap;
+
+	for (size_t m = 0; m < ARRAY_SIZE(bench_maps); ++m) {
+		hmap = bench_maps[m];
+
+		for (size_t i = 0; i < window; ++i) {
+			zassert_equal(1, sys_hashmap_insert(hmap, bench_key(i), i, NULL));
+		}
+		n_buckets = hmap->data->n_buckets;
+
+		start = k_cycle_get_32();
+		for (size_t i = window; i < window + BENCH_CHURN_ROUNDS; ++i) {
+			zassert_true(sys_hashmap_remove(hmap, bench_key(i - window), NULL));
+			ret = sys_hashmap_insert(hmap, bench_key(i), i, NULL);
+			zassert_equal(1, ret, "failed to insert %zu: %d", i, ret);
+		}
+		cycles = k_cycle_get_32() - start;
+		report("churn", hmap->config->load_factor, cycles, 2 * BENCH_CHURN_ROUNDS);
+
+		zassert_equal(window, sys_hashmap_size(hmap));
+		zassert_true(sys_hashmap_load_factor(hmap) <= hmap->config->load_factor);
+		zassert_true(hmap->data->n_buckets <= 2 * n_buckets, "table grew from %zu to %zu",
+			     n_buckets, hmap->data->n_buckets);
+
+		for (size_t i = BENCH_CHURN_ROUNDS; i < window + BENCH_CHURN_ROUNDS; ++i) {
+			zassert_true(sys_hashmap_contains_key(hmap, bench_key(i)));
+		}
+		for (size_t i = 0; i < BENCH_CHURN_ROUNDS; ++i) {
+			zassert_false(sys_hashmap_contains_key(hmap, bench_key(i)));
+		}
+	}
+}
+
+ZTEST_SUITE(hash_map_bench, NULL, NULL, NULL, bench_after, NULL);
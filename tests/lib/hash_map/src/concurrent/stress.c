@@ -0,0 +1,209 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Hammer a Concurrent Hashmap from several threads, on several CPUs with
+ * CONFIG_SMP. Every thread owns a range of keys which it inserts, replaces,
+ * looks up and removes at random, checking each result against a private
+ * model, while the range of every thread filling up and draining keeps the
+ * table growing and shrinking. All threads also look up a set of shared
+ * keys which must stay visible, with their value, throughout.
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+#define STRESS_THREADS	   4
+#define STRESS_KEYS	   64
+#define STRESS_SHARED_KEYS 32
+#define STRESS_OPS	   20000
+#define STRESS_STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#define SHARED_KEY(i)	  (0xffff0000ULL + (i))
+#define THREAD_KEY(t, i)  (((uint64_t)(t) << 32) | (i))
+#define KEY_VALUE(k, gen) ((k) ^ ((uint64_t)(gen) << 40))
+
+/* Contents need not be preserved, but the allocator is used concurrently */
+static void *stress_alloc(void *ptr, size_t size)
+{
+	k_free(ptr);
+
+	return (size == 0) ? NULL : k_malloc(size);
+}
+
+SYS_HASHMAP_CONCURRENT_DEFINE_STATIC_ADVANCED(stress_map, sys_hash32, stress_alloc,
+					      SYS_HASHMAP_CONFIG(SIZE_MAX,
+								 SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
+
+K_THREAD_STACK_ARRAY_DEFINE(stress_stacks, STRESS_THREADS, STRESS_STACK_SIZE);
+static struct k_thread stress_threads[STRESS_THREADS];
+
+struct stress_result {
+	uint32_t errors;
+	uint32_t live;
+	uint32_t inserts;
+	uint32_t removes;
+};
+
+static struct stress_result results[STRESS_THREADS];
+
+/* Private to each thread, a shared generator would serialize them */
+static uint32_t stress_rand(uint32_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+
+	return *state;
+}
+
+static void stress_entry(void *p1, void *p2, void *p3)
+{
+	int ret;
+	size_t i;
+	uint32_t r;
+	uint64_t key;
+	uint64_t value;
+	uintptr_t t = (uintptr_t)p1;
+	uint32_t seed = 0x9e3779b9U * (t + 1);
+	struct stress_result *res = &results[t];
+	/* generation of the value stored for each key, 0 when absent */
+	uint32_t gen[STRESS_KEYS] = {0};
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t op = 0; op < STRESS_OPS; ++op) {
+		r = stress_rand(&seed);
+
+		if ((r & 7) == 0) {
+			key = SHARED_KEY((r >> 8) % STRESS_SHARED_KEYS);
+			if (!sys_hashmap_get(&stress_map, key, &value) ||
+			    value != KEY_VALUE(key, 1)) {
+				++res->errors;
+			}
+			continue;
+		}
+
+		i = (r >> 8) % STRESS_KEYS;
+		key = THREAD_KEY(t, i);
+
+		switch ((r >> 3) % 3) {
+		case 0:
+			ret = sys_hashmap_insert(&stress_map, key, KEY_VALUE(key, gen[i] + 1),
+						 &value);
+			if (ret != (gen[i] == 0) ||
+			    (ret == 0 && value != KEY_VALUE(key, gen[i]))) {
+				++res->errors;
+			}
+			res->inserts += ret;
+			++gen[i];
+			break;
+		case 1:
+			if (sys_hashmap_remove(&stress_map, key, &value) != (gen[i] != 0) ||
+			    (gen[i] != 0 && value != KEY_VALUE(key, gen[i]))) {
+				++res->errors;
+			}
+			res->removes += (gen[i] != 0);
+			gen[i] = 0;
+			break;
+		default:
+			if (sys_hashmap_get(&stress_map, key, &value) != (gen[i] != 0) ||
+			    (gen[i] != 0 && value != KEY_VALUE(key, gen[i]))) {
+				++res->errors;
+			}
+			break;
+		}
+	}
+
+	for (i = 0; i < STRESS_KEYS; ++i) {
+		res->live += (gen[i] != 0);
+	}
+}
+
+static void *stress_setup(void)
+{
+	TC_PRINT("%u CPUs, %u threads, %u stripes\n", arch_num_cpus(), STRESS_THREADS,
+		 CONFIG_SYS_HASH_MAP_CONCURRENT_STRIPES);
+
+	return NULL;
+}
+
+static void stress_after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	(void)sys_hashmap_clear(&stress_map, NULL, NULL);
+}
+
+ZTEST(hash_map_concurrent, test_stress)
+{
+	size_t live = STRESS_SHARED_KEYS;
+	uint32_t start;
+	uint32_t cycles;
+
+	for (size_t i = 0; i < STRESS_SHARED_KEYS; ++i) {
+		zassert_equal(1, sys_hashmap_insert(&stress_map, SHARED_KEY(i),
+						    KEY_VALUE(SHARED_KEY(i), 1), NULL));
+	}
+
+	memset(results, 0, sizeof(results));
+
+	start = k_cycle_get_32();
+	for (uintptr_t t = 0; t < STRESS_THREADS; ++t) {
+		k_thread_create(&stress_threads[t], stress_stacks[t], STRESS_STACK_SIZE,
+				stress_entry, (void *)t, NULL, NULL, K_PRIO_PREEMPT(1), 0,
+				K_NO_WAIT);
+	}
+
+	for (size_t t = 0; t < STRESS_THREADS; ++t) {
+		zassert_ok(k_thread_join(&stress_threads[t], K_FOREVER));
+	}
+	cycles = k_cycle_get_32() - start;
+
+	TC_PRINT("%u ops in %u cycles\n", STRESS_THREADS * STRESS_OPS, cycles);
+
+	for (size_t t = 0; t < STRESS_THREADS; ++t) {
+		zassert_equal(0, results[t].errors, "thread %zu saw %u errors", t,
+			      results[t].errors);
+		zassert_true(results[t].inserts > 0 && results[t].removes > 0);
+		live += results[t].live;
+	}
+
+	zassert_equal(live, sys_hashmap_size(&stress_map));
+
+	for (size_t i = 0; i < STRESS_SHARED_KEYS; ++i) {
+		zassert_true(sys_hashmap_contains_key(&stress_map, SHARED_KEY(i)));
+	}
+}
+
+ZTEST(hash_map_concurrent, test_concurrent_clear)
+{
+	/* two threads refill the map while it is being cleared */
+	for (uintptr_t t = 0; t < 2; ++t) {
+		k_thread_create(&stress_threads[t], stress_stacks[t], STRESS_STACK_SIZE,
+				stress_entry, (void *)t, NULL, NULL, K_PRIO_PREEMPT(1), 0,
+				K_NO_WAIT);
+	}
+
+	for (int i = 0; i < 100; ++i) {
+		(void)sys_hashmap_clear(&stress_map, NULL, NULL);
+		k_msleep(1);
+	}
+
+	for (size_t t = 0; t < 2; ++t) {
+		zassert_ok(k_thread_join(&stress_threads[t], K_FOREVER));
+	}
+
+	/* results are meaningless here, the map only has to stay consistent */
+	(void)sys_hashmap_clear(&stress_map, NULL, NULL);
+	zassert_true(sys_hashmap_is_empty(&stress_map));
+}
+
+ZTEST_SUITE(hash_map_concurrent, NULL, stress_setup, NULL, stress_after, NULL);
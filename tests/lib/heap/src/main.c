@@ -8,6 +8,7 @@
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/heap_listener.h>
 #include <inttypes.h>
+#include <string.h>
 
 /* Guess at a value for heap size based on available memory on the
  * platform, with workarounds.
@@ -42,14 +43,26 @@
 #define SMALL_HEAP_SZ MIN(BIG_HEAP_SZ, 2048)
 
 /* With enabling SYS_HEAP_RUNTIME_STATS, the size of struct z_heap
- * will increase 16 bytes on 64 bit CPU.
+ * will increase 16 bytes on 64 bit CPU.  The TLSF index adds 32 bytes
+ * of second level bitmaps and more bucket heads.
  */
-#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+#if defined(CONFIG_SYS_HEAP_TLSF) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+#define SOLO_FREE_HEADER_HEAP_SZ \
+	((size_t[]){ 136, 176, 264 }[CONFIG_SYS_HEAP_TLSF_SL_LOG2 - 1])
+#elif defined(CONFIG_SYS_HEAP_TLSF)
+#define SOLO_FREE_HEADER_HEAP_SZ \
+	((size_t[]){ 112, 152, 232 }[CONFIG_SYS_HEAP_TLSF_SL_LOG2 - 1])
+#elif defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
 #define SOLO_FREE_HEADER_HEAP_SZ (80)
 #else
 #define SOLO_FREE_HEADER_HEAP_SZ (64)
 #endif
 
+/* Heap size and live block count for the mixed workload measurements */
+#define MIXED_HEAP_SZ MIN(BIG_HEAP_SZ, 16 * 1024)
+#define MIXED_SLOTS 64
+#define MIXED_OPS (4 * MIXED_HEAP_SZ)
+
 #define SCRATCH_SZ (sizeof(heapmem) / 2)
 
 /* The test memory.  Make them pointer arrays for robust alignment
@@ -238,6 +251,141 @@ ZTEST(lib_heap, test_big_heap)
 	log_result(BIG_HEAP_SZ, &result);
 }
 
+struct mixed_result {
+	uint32_t allocs;
+	uint32_t failures;
+	uint32_t frees;
+	uint32_t alloc_max;
+	uint32_t free_max;
+	uint64_t alloc_total;
+	uint64_t free_total;
+};
+
+static uint32_t mixed_rand(uint32_t *state)
+{
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+
+	return x;
+}
+
+/* Long-running mix of many short small blocks and fewer large ones,
+ * the classic recipe for fragmentation.  Each operation picks a slot
+ * at random and frees it if live or fills it otherwise.  Only the
+ * sys_heap calls are timed (note CONFIG_SYS_HEAP_VALIDATE adds its
+ * internal checks to them).
+ */
+static void mixed_workload(struct sys_heap *heap, void **slots,
+			   struct mixed_result *r)
+{
+	uint32_t seed = 0x2545f491U;
+
+	memset(r, 0, sizeof(*r));
+
+	for (int i = 0; i < MIXED_OPS; i++) {
+		uint32_t rnd = mixed_rand(&seed);
+		int slot = rnd % MIXED_SLOTS;
+		uint32_t t0, dt;
+
+		if (slots[slot] != NULL) {
+			t0 = k_cycle_get_32();
+			sys_heap_free(heap, slots[slot]);
+			dt = k_cycle_get_32() - t0;
+
+			slots[slot] = NULL;
+			r->frees++;
+			r->free_total += dt;
+			r->free_max = MAX(r->free_max, dt);
+		} else {
+			size_t sz = ((rnd >> 8) % 4 == 0) ?
+				256 + (rnd >> 12) % 1792 : 8 + (rnd >> 12) % 56;
+
+			t0 = k_cycle_get_32();
+			slots[slot] = sys_heap_alloc(heap, sz);
+			dt = k_cycle_get_32() - t0;
+
+			r->allocs++;
+			r->alloc_total += dt;
+			r->alloc_max = MAX(r->alloc_max, dt);
+			if (slots[slot] == NULL) {
+				r->failures++;
+			}
+		}
+	}
+}
+
+/* Largest block the heap can currently hand out, by bisection */
+static size_t largest_alloc(struct sys_heap *heap, size_t limit)
+{
+	size_t lo = 0, hi = limit;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo + 1) / 2;
+		void *p = sys_heap_alloc(heap, mid);
+
+		if (p != NULL) {
+			sys_heap_free(heap, p);
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+/* Compare allocation policies (build with and without
+ * CONFIG_SYS_HEAP_TLSF): report the failure rate and worst case and
+ * average cycles per operation of a mixed workload, then how
+ * fragmented the free space it leaves behind is.
+ */
+ZTEST(lib_heap, test_mixed_workload)
+{
+	struct sys_heap heap;
+	struct mixed_result r;
+	void **slots = (void **)scratchmem;
+	size_t free_bytes = MIXED_HEAP_SZ, largest;
+
+	zassert_true(MIXED_SLOTS * sizeof(void *) <= sizeof(scratchmem), "");
+	memset(slots, 0, MIXED_SLOTS * sizeof(void *));
+
+	TC_PRINT("Testing mixed workload on a (%d byte) %s heap\n",
+		 (int) MIXED_HEAP_SZ,
+		 IS_ENABLED(CONFIG_SYS_HEAP_TLSF) ? "TLSF" : "bucket");
+
+	sys_heap_init(&heap, heapmem, MIXED_HEAP_SZ);
+	mixed_workload(&heap, slots, &r);
+	zassert_true(sys_heap_validate(&heap), "");
+	zassert_true(r.allocs > r.failures, "no allocation succeeded");
+
+	TC_PRINT("allocs: %u (%u failed), alloc cycles max %u avg %u, "
+		 "free cycles max %u avg %u\n",
+		 r.allocs, r.failures,
+		 r.alloc_max, (uint32_t)(r.alloc_total / r.allocs),
+		 r.free_max, (uint32_t)(r.free_total / MAX(r.frees, 1U)));
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	struct sys_memory_stats stats;
+
+	sys_heap_runtime_stats_get(&heap, &stats);
+	free_bytes = stats.free_bytes;
+#endif
+	largest = largest_alloc(&heap, free_bytes);
+
+	TC_PRINT("free bytes: %u, largest block: %u (%u%% fragmented)\n",
+		 (uint32_t)free_bytes, (uint32_t)largest,
+		 free_bytes ? (uint32_t)(100 - 100 * largest / free_bytes) : 0U);
+
+	for (int i = 0; i < MIXED_SLOTS; i++) {
+		sys_heap_free(&heap, slots[i]);
+	}
+	zassert_true(sys_heap_validate(&heap), "");
+}
+
 /* Test a heap with a solo free header.  A solo free header can exist
  * only on a heap with 64 bit CPU (or chunk_header_bytes() == 8).
  * With 64 bytes heap and 1 byte allocation on a big heap, we get:
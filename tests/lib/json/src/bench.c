@@ -0,0 +1,245 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Parse and encode timing on a SenML-like payload of a few KiB. Compare
+ * runs of the default and the libraries.encoding.json.fast scenarios.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/data/json.h>
+
+#define BENCH_RECORDS	64
+#define BENCH_ROUNDS	20
+#define BENCH_FRAGMENT	128
+
+struct bench_record {
+	const char *n;
+	int32_t v;
+	const char *u;
+	int32_t t;
+	bool vb;
+};
+
+struct bench_pack {
+	struct bench_record e[BENCH_RECORDS];
+	size_t e_len;
+};
+
+static const struct json_obj_descr bench_record_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct bench_record, n, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct bench_record, v, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct bench_record, u, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct bench_record, t, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct bench_record, vb, JSON_TOK_TRUE),
+};
+
+static const struct json_obj_descr bench_pack_descr[] = {
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct bench_pack, e, BENCH_RECORDS, e_len,
+				 bench_record_descr,
+				 ARRAY_SIZE(bench_record_descr)),
+};
+
+/* Flat object with many fields, where the field lookup dominates */
+struct bench_wide {
+	int32_t f[32];
+};
+
+#define WIDE_FIELD(i) \
+	JSON_OBJ_DESCR_PRIM_NAMED(struct bench_wide, "field_" #i, f[i], JSON_TOK_NUMBER)
+
+static const struct json_obj_descr bench_wide_descr[] = {
+	WIDE_FIELD(0), WIDE_FIELD(1), WIDE_FIELD(2), WIDE_FIELD(3),
+	WIDE_FIELD(4), WIDE_FIELD(5), WIDE_FIELD(6), WIDE_FIELD(7),
+	WIDE_FIELD(8), WIDE_FIELD(9), WIDE_FIELD(10), WIDE_FIELD(11),
+	WIDE_FIELD(12), WIDE_FIELD(13), WIDE_FIELD(14), WIDE_FIELD(15),
+	WIDE_FIELD(16), WIDE_FIELD(17), WIDE_FIELD(18), WIDE_FIELD(19),
+	WIDE_FIELD(20), WIDE_FIELD(21), WIDE_FIELD(22), WIDE_FIELD(23),
+	WIDE_FIELD(24), WIDE_FIELD(25), WIDE_FIELD(26), WIDE_FIELD(27),
+	WIDE_FIELD(28), WIDE_FIELD(29), WIDE_FIELD(30), WIDE_FIELD(31),
+};
+
+static char payload[BENCH_RECORDS * 112];
+static size_t payload_len;
+static char wide_payload[32 * 24];
+static size_t wide_payload_len;
+static char work[sizeof(payload)];
+static struct bench_pack pack;
+static struct bench_wide wide;
+
+static void *bench_setup(void)
+{
+	size_t len;
+
+	len = snprintf(payload, sizeof(payload), "[\n");
+	for (int i = 0; i < BENCH_RECORDS; i++) {
+		len += snprintf(payload + len, sizeof(payload) - len,
+				"  {\"n\": \"urn:dev:ow:10e2073a0108006:sensor_%02d\", "
+				"\"v\": %d, \"u\": \"Cel\", \"t\": %d, \"vb\": %s}%s\n",
+				i, 200 + i, -i, (i % 2) ? "true" : "false",
+				(i == BENCH_RECORDS - 1) ? "" : ",");
+	}
+	len += snprintf(payload + len, sizeof(payload) - len, "]");
+	zassert_true(len < sizeof(payload), "payload buffer too small");
+	payload_len = len;
+
+	len = snprintf(wide_payload, sizeof(wide_payload), "{");
+	for (int i = 31; i >= 0; i--) {
+		len += snprintf(wide_payload + len, sizeof(wide_payload) - len,
+				"\"field_%d\":%d%s", i, i, (i == 0) ? "}" : ",");
+	}
+	zassert_true(len < sizeof(wide_payload), "payload buffer too small");
+	wide_payload_len = len;
+
+	return NULL;
+}
+
+static void report(const char *what, uint32_t cycles, size_t bytes)
+{
+	uint64_t ns = k_cyc_to_ns_ceil64(cycles);
+
+	TC_PRINT("%-24s %8u cycles for %u bytes, %llu bytes/ms\n", what,
+		 cycles, (unsigned int)bytes,
+		 ns ? (uint64_t)bytes * 1000000U / ns : 0);
+}
+
+/**
+ * @brief Time parsing an array of records into structs
+ */
+ZTEST(lib_json_bench, test_bench_arr_parse)
+{
+	uint32_t cycles = 0;
+
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		uint32_t start;
+		int ret;
+
+		/* Parsing terminates strings in place, start from a copy */
+		memcpy(work, payload, payload_len);
+
+		start = k_cycle_get_32();
+		ret = json_arr_parse(work, payload_len, bench_pack_descr, &pack);
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(ret, 0, "parse failed (%d)", ret);
+	}
+
+	zassert_equal(pack.e_len, BENCH_RECORDS);
+	zassert_equal(pack.e[BENCH_RECORDS - 1].v, 200 + BENCH_RECORDS - 1);
+	zassert_equal(strcmp(pack.e[3].n, "urn:dev:ow:10e2073a0108006:sensor_03"), 0);
+
+	report("json_arr_parse", cycles, payload_len * BENCH_ROUNDS);
+}
+
+/**
+ * @brief Time parsing an object with many fields in reverse order
+ */
+ZTEST(lib_json_bench, test_bench_wide_parse)
+{
+	uint32_t cycles = 0;
+
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		uint32_t start;
+		int64_t ret;
+
+		memcpy(work, wide_payload, wide_payload_len);
+
+		start = k_cycle_get_32();
+		ret = json_obj_parse(work, wide_payload_len, bench_wide_descr,
+				     ARRAY_SIZE(bench_wide_descr), &wide);
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(ret, BIT64_MASK(32), "parse failed (%lld)", ret);
+	}
+
+	zassert_equal(wide.f[17], 17);
+
+	report("json_obj_parse, 32 keys", cycles, wide_payload_len * BENCH_ROUNDS);
+}
+
+/**
+ * @brief Time encoding the parsed records back
+ */
+ZTEST(lib_json_bench, test_bench_arr_encode)
+{
+	uint32_t cycles = 0;
+	ssize_t len = 0;
+
+	memcpy(work, payload, payload_len);
+	zassert_equal(json_arr_parse(work, payload_len, bench_pack_descr, &pack), 0);
+
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		static char out[sizeof(payload)];
+		uint32_t start;
+		int ret;
+
+		start = k_cycle_get_32();
+		ret = json_arr_encode_buf(bench_pack_descr, &pack, out, sizeof(out));
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(ret, 0, "encode failed (%d)", ret);
+		len = strlen(out);
+	}
+
+	report("json_arr_encode_buf", cycles, len * BENCH_ROUNDS);
+}
+
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+static int count_token(enum json_tokens type, const char *start, size_t len,
+		       void *user_data)
+{
+	ARG_UNUSED(type);
+	ARG_UNUSED(start);
+	ARG_UNUSED(len);
+
+	(*(size_t *)user_data)++;
+
+	return 0;
+}
+
+/**
+ * @brief Time tokenizing the payload in fragments
+ */
+ZTEST(lib_json_bench, test_bench_stream)
+{
+	static char split_buf[64];
+	uint32_t cycles = 0;
+	size_t count = 0;
+
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		struct json_stream stream;
+		uint32_t start;
+		int ret = 0;
+
+		count = 0;
+		json_stream_init(&stream, split_buf, sizeof(split_buf),
+				 count_token, &count);
+
+		start = k_cycle_get_32();
+		for (size_t pos = 0; pos < payload_len && ret == 0;
+		     pos += BENCH_FRAGMENT) {
+			ret = json_stream_feed(&stream, payload + pos,
+					       MIN(BENCH_FRAGMENT, payload_len - pos));
+		}
+		if (ret == 0) {
+			ret = json_stream_finish(&stream);
+		}
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(ret, 0, "stream failed (%d)", ret);
+	}
+
+	/* '[' ']', 63 ',' and per record '{' '}' plus 5 keys, values and ':' and 4 ',' */
+	zassert_equal(count, 2 + (BENCH_RECORDS - 1) + BENCH_RECORDS * (2 + 15 + 4));
+
+	report("json_stream_feed", cycles, payload_len * BENCH_ROUNDS);
+}
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
+ZTEST_SUITE(lib_json_bench, NULL, bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,192 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/data/json.h>
+
+#ifdef CONFIG_NET_BUF
+#include <zephyr/net/buf.h>
+#endif
+
+static const char stream_doc[] =
+	"{ \"bn\": \"urn:dev:ow:10e2073a01080063\",\n"
+	"  \"e\": [ { \"n\": \"voltage\", \"v\": 120, \"u\": \"V\" },\n"
+	"         { \"n\": \"on\", \"vb\": true, \"esc\": \"a\\\"b\\u00e9\" },\n"
+	"         { \"n\": \"none\", \"v\": null, \"t\": -5 } ] }";
+
+/* Token stream of stream_doc, one character for the type then the text */
+static const char stream_tokens[] =
+	"{\"bn:\"urn:dev:ow:10e2073a01080063,\"e:[{\"n:\"voltage,\"v:0120,"
+	"\"u:\"V},{\"n:\"on,\"vb:ttrue,\"esc:\"a\\\"b\\u00e9},{\"n:\"none,"
+	"\"v:nnull,\"t:0-5}]}";
+
+static char tokens[512];
+static size_t tokens_len;
+static char split_buf[64];
+
+static int record_token(enum json_tokens type, const char *start, size_t len,
+			void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	zassert_true(tokens_len + 1 + len < sizeof(tokens));
+
+	tokens[tokens_len++] = (char)type;
+	memcpy(&tokens[tokens_len], start, len);
+	tokens_len += len;
+	tokens[tokens_len] = '\0';
+
+	return 0;
+}
+
+static int stream_parse(const char *doc, const size_t *cuts, size_t num_cuts)
+{
+	struct json_stream stream;
+	size_t prev = 0;
+	int ret;
+
+	tokens_len = 0;
+	tokens[0] = '\0';
+
+	ret = json_stream_init(&stream, split_buf, sizeof(split_buf),
+			       record_token, NULL);
+	zassert_equal(ret, 0);
+
+	for (size_t i = 0; i <= num_cuts; i++) {
+		size_t cut = (i < num_cuts) ? cuts[i] : strlen(doc);
+
+		ret = json_stream_feed(&stream, doc + prev, cut - prev);
+		if (ret != 0) {
+			return ret;
+		}
+		prev = cut;
+	}
+
+	return json_stream_finish(&stream);
+}
+
+/**
+ * @brief Test that a document parsed in one piece gives the expected tokens
+ */
+ZTEST(lib_json_stream, test_stream_whole)
+{
+	zassert_equal(stream_parse(stream_doc, NULL, 0), 0);
+	zassert_equal(strcmp(tokens, stream_tokens), 0, "got %s", tokens);
+}
+
+/**
+ * @brief Test that tokens are the same wherever the document is split
+ */
+ZTEST(lib_json_stream, test_stream_split)
+{
+	size_t len = strlen(stream_doc);
+
+	for (size_t a = 0; a <= len; a++) {
+		for (size_t b = a; b <= len; b += 7) {
+			size_t cuts[] = { a, b };
+
+			zassert_equal(stream_parse(stream_doc, cuts, ARRAY_SIZE(cuts)), 0,
+				      "failed for cuts at %zu, %zu", a, b);
+			zassert_equal(strcmp(tokens, stream_tokens), 0,
+				      "wrong tokens for cuts at %zu, %zu", a, b);
+		}
+	}
+}
+
+/**
+ * @brief Test that one byte fragments work
+ */
+ZTEST(lib_json_stream, test_stream_bytes)
+{
+	static size_t cuts[sizeof(stream_doc)];
+
+	for (size_t i = 0; i < ARRAY_SIZE(cuts); i++) {
+		cuts[i] = MIN(i, strlen(stream_doc));
+	}
+
+	zassert_equal(stream_parse(stream_doc, cuts, ARRAY_SIZE(cuts)), 0);
+	zassert_equal(strcmp(tokens, stream_tokens), 0, "got %s", tokens);
+}
+
+/**
+ * @brief Test that invalid or truncated documents are rejected
+ */
+ZTEST(lib_json_stream, test_stream_invalid)
+{
+	static const char *const invalid[] = {
+		"{\"a\" 1}", "[1,]", "{\"a\":1,}", "[tru]", "\"abc", "{\"a\":\"\\x\"}",
+		"-", "[1 2]", "{}}", "[-a]", "\"\\u12g4\"", "{\"a\":1", "{1:2}",
+		"[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[1]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]",
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(invalid); i++) {
+		zassert_equal(stream_parse(invalid[i], NULL, 0), -EINVAL,
+			      "accepted %s", invalid[i]);
+	}
+
+	zassert_equal(stream_parse("42", NULL, 0), 0);
+	zassert_equal(strcmp(tokens, "042"), 0, "got %s", tokens);
+}
+
+/**
+ * @brief Test that a split token longer than the buffer is reported
+ */
+ZTEST(lib_json_stream, test_stream_token_too_long)
+{
+	static char doc[sizeof(split_buf) + 8];
+	size_t cuts[] = { sizeof(doc) / 2 };
+
+	memset(doc, 'x', sizeof(doc) - 1);
+	doc[0] = '"';
+	doc[sizeof(doc) - 2] = '"';
+	doc[sizeof(doc) - 1] = '\0';
+
+	/* Fine in one piece, nothing needs to be copied */
+	zassert_equal(stream_parse(doc, NULL, 0), 0);
+	zassert_equal(stream_parse(doc, cuts, ARRAY_SIZE(cuts)), -ENOMEM);
+}
+
+#ifdef CONFIG_NET_BUF
+NET_BUF_POOL_DEFINE(json_stream_pool, 8, 16, 0, NULL);
+
+/**
+ * @brief Test parsing a chain of network buffer fragments
+ */
+ZTEST(lib_json_stream, test_stream_net_buf)
+{
+	struct net_buf *head = NULL;
+	struct json_stream stream;
+	size_t len = strlen(stream_doc);
+	size_t pos = 0;
+
+	while (pos < len) {
+		struct net_buf *frag = net_buf_alloc(&json_stream_pool, K_NO_WAIT);
+		size_t n = MIN(net_buf_tailroom(frag), len - pos);
+
+		zassert_not_null(frag);
+		net_buf_add_mem(frag, stream_doc + pos, n);
+		pos += n;
+
+		if (head == NULL) {
+			head = frag;
+		} else {
+			net_buf_frag_add(head, frag);
+		}
+	}
+
+	tokens_len = 0;
+	zassert_equal(json_stream_init(&stream, split_buf, sizeof(split_buf),
+				       record_token, NULL), 0);
+	zassert_equal(json_stream_feed_net_buf(&stream, head), 0);
+	zassert_equal(json_stream_finish(&stream), 0);
+	zassert_equal(strcmp(tokens, stream_tokens), 0, "got %s", tokens);
+
+	net_buf_unref(head);
+}
+#endif /* CONFIG_NET_BUF */
+
+ZTEST_SUITE(lib_json_stream, NULL, NULL, NULL, NULL, NULL);
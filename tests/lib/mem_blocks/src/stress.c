@@ -0,0 +1,179 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <zephyr/sys/mem_blocks.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Stress and timing of contiguous allocation on a large, fragmented
+ * pool. Run with and without CONFIG_SYS_BITARRAY_SUMMARY to compare.
+ */
+
+#define STRESS_BLK_SZ		8
+#define STRESS_NUM_BLOCKS	1024
+#define STRESS_HOLE_BLOCKS	64
+#define STRESS_ALLOC_BLOCKS	32
+#define STRESS_ROUNDS		100
+#define STRESS_CHURN_OPS	4000
+#define STRESS_MAX_LIVE		64
+
+SYS_MEM_BLOCKS_DEFINE_STATIC(stress_pool, STRESS_BLK_SZ, STRESS_NUM_BLOCKS, 4);
+
+static uint8_t block_used[STRESS_NUM_BLOCKS];
+
+static struct {
+	uint8_t *ptr;
+	size_t count;
+} live[STRESS_MAX_LIVE];
+
+static uint32_t rand_state = 1;
+
+static uint32_t stress_rand(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+
+	return rand_state >> 16;
+}
+
+static size_t block_index(void *ptr)
+{
+	return ((uint8_t *)ptr - stress_pool.buffer) / STRESS_BLK_SZ;
+}
+
+static void print_timing(const char *what, uint32_t cycles, uint32_t ops)
+{
+	TC_PRINT("%s: %u ops, %u cycles, %llu ns per op\n", what, ops, cycles,
+		 k_cyc_to_ns_ceil64(cycles) / ops);
+}
+
+/**
+ * @brief Time contiguous allocation behind a fragmented region
+ *
+ * Every other block is in use except for a hole at the very end, so a
+ * contiguous request has to get past the whole fragmented part of the
+ * pool before it fits.
+ */
+ZTEST(lib_mem_block_stress, test_contiguous_fragmented)
+{
+	static void *blocks[STRESS_NUM_BLOCKS];
+	uint8_t *hole = stress_pool.buffer +
+			(STRESS_NUM_BLOCKS - STRESS_HOLE_BLOCKS) * STRESS_BLK_SZ;
+	uint32_t start, cycles;
+	void *ptr;
+	int ret;
+
+	for (size_t i = 0; i < STRESS_NUM_BLOCKS; i++) {
+		ret = sys_mem_blocks_alloc(&stress_pool, 1, &blocks[i]);
+		zassert_equal(ret, 0, "cannot allocate block %zu (%d)", i, ret);
+	}
+
+	/* Keep the block right before the hole, so that it is exactly
+	 * STRESS_HOLE_BLOCKS long
+	 */
+	for (size_t i = 0; i < STRESS_NUM_BLOCKS; i++) {
+		size_t idx = block_index(blocks[i]);
+
+		if (((idx % 2 == 1) && (idx < STRESS_NUM_BLOCKS - STRESS_HOLE_BLOCKS - 1)) ||
+		    (idx >= STRESS_NUM_BLOCKS - STRESS_HOLE_BLOCKS)) {
+			zassert_equal(sys_mem_blocks_free(&stress_pool, 1, &blocks[i]), 0);
+			blocks[i] = NULL;
+		}
+	}
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < STRESS_ROUNDS; i++) {
+		ret = sys_mem_blocks_alloc_contiguous(&stress_pool,
+						      STRESS_ALLOC_BLOCKS, &ptr);
+		zassert_equal(ret, 0, "contiguous allocation failed (%d)", ret);
+		zassert_equal_ptr(ptr, hole, "allocation outside of the hole");
+
+		ret = sys_mem_blocks_free_contiguous(&stress_pool, ptr,
+						     STRESS_ALLOC_BLOCKS);
+		zassert_equal(ret, 0);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	print_timing("fragmented alloc_contiguous + free", cycles, STRESS_ROUNDS);
+
+	/* Nothing larger than the hole fits */
+	ret = sys_mem_blocks_alloc_contiguous(&stress_pool,
+					      STRESS_HOLE_BLOCKS + 1, &ptr);
+	zassert_equal(ret, -ENOMEM, "allocation should have failed (%d)", ret);
+
+	for (size_t i = 0; i < STRESS_NUM_BLOCKS; i++) {
+		if (blocks[i] != NULL) {
+			zassert_equal(sys_mem_blocks_free(&stress_pool, 1, &blocks[i]), 0);
+		}
+	}
+}
+
+/**
+ * @brief Random contiguous allocations and frees
+ *
+ * Keeps a shadow map of the blocks in use to check that no two
+ * allocations ever overlap.
+ */
+ZTEST(lib_mem_block_stress, test_contiguous_churn)
+{
+	uint32_t start, cycles;
+	size_t nlive = 0;
+	void *ptr;
+	int ret;
+
+	start = k_cycle_get_32();
+	for (int op = 0; op < STRESS_CHURN_OPS; op++) {
+		if ((nlive == STRESS_MAX_LIVE) ||
+		    ((nlive > 0) && (stress_rand() % 2 == 0))) {
+			size_t i = stress_rand() % nlive;
+			size_t idx = block_index(live[i].ptr);
+
+			ret = sys_mem_blocks_free_contiguous(&stress_pool,
+							     live[i].ptr,
+							     live[i].count);
+			zassert_equal(ret, 0, "free failed (%d)", ret);
+			memset(&block_used[idx], 0, live[i].count);
+
+			live[i] = live[--nlive];
+			continue;
+		}
+
+		size_t count = 1 + stress_rand() % STRESS_ALLOC_BLOCKS;
+
+		ret = sys_mem_blocks_alloc_contiguous(&stress_pool, count, &ptr);
+		if (ret != 0) {
+			zassert_equal(ret, -ENOMEM, "unexpected error %d", ret);
+			continue;
+		}
+
+		size_t idx = block_index(ptr);
+
+		zassert_true(idx + count <= STRESS_NUM_BLOCKS);
+		for (size_t i = idx; i < idx + count; i++) {
+			zassert_false(block_used[i], "block %zu allocated twice", i);
+			block_used[i] = 1;
+		}
+
+		live[nlive].ptr = ptr;
+		live[nlive].count = count;
+		nlive++;
+	}
+	cycles = k_cycle_get_32() - start;
+
+	print_timing("random alloc_contiguous / free", cycles, STRESS_CHURN_OPS);
+
+	while (nlive > 0) {
+		nlive--;
+		zassert_equal(sys_mem_blocks_free_contiguous(&stress_pool,
+							     live[nlive].ptr,
+							     live[nlive].count), 0);
+	}
+}
+
+ZTEST_SUITE(lib_mem_block_stress, NULL, NULL, NULL, NULL, NULL);